@@ -33,16 +33,32 @@ MSSMcbs<Two_scale>::~MSSMcbs()
 {
 }
 
-Eigen::ArrayXd MSSMcbs<Two_scale>::beta() const
+/**
+ * Writes the beta functions into the given array.  The RG running and
+ * beta() obtain the beta functions from this function.
+ *
+ * @param pars array of beta functions (output)
+ */
+void MSSMcbs<Two_scale>::fill_beta(Eigen::Ref<Eigen::ArrayXd> pars) const
 {
-   return calc_beta().get();
+   CMSSM<Two_scale>::fill_beta(pars);
+
+   if (get_loops() > 2)
+      pars(CMSSM_info::g3) += calc_beta_g3_3loop();
 }
 
 CMSSM_soft_parameters MSSMcbs<Two_scale>::calc_beta() const
 {
    CMSSM_soft_parameters betas(CMSSM<Two_scale>::calc_beta());
-   if (get_loops() <= 2) return betas;
 
+   if (get_loops() > 2)
+      betas.set_g3(betas.get_g3() + calc_beta_g3_3loop());
+
+   return betas;
+}
+
+double MSSMcbs<Two_scale>::calc_beta_g3_3loop() const
+{
    // 3-loop g3 beta function from http://www.liv.ac.uk/~dij/betas/
 
    Eigen::Matrix<double,3,3> Yt = Yu.transpose();
@@ -70,9 +86,7 @@ CMSSM_soft_parameters MSSMcbs<Two_scale>::calc_beta() const
 	     + 18*Sqr((Ybc*Yb).trace()) + 6*(Ybc*Yb).trace()*(Ylc*Yl).trace()
 	     + 12*(Ybc*Yb*Ybc*Yb).trace() );
 
-   betas.set_g3(betas.get_g3() + Power(oneOver16PiSqr,3) * g3 * bg33);
-
-   return betas;
+   return Power(oneOver16PiSqr,3) * g3 * bg33;
 }
 
 } // namespace flexiblesusy
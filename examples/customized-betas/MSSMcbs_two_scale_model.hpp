@@ -30,8 +30,11 @@ public:
    explicit MSSMcbs(const CMSSM_input_parameters& input_ = CMSSM_input_parameters());
    virtual ~MSSMcbs();
 
-   virtual Eigen::ArrayXd beta() const;
+   virtual void fill_beta(Eigen::Ref<Eigen::ArrayXd>) const override;
    CMSSM_soft_parameters calc_beta() const;
+
+private:
+   double calc_beta_g3_3loop() const;
 };
 
 } // namespace flexiblesusy
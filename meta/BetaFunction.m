@@ -29,6 +29,8 @@ CreateBetaFunction::usage="";
 GetAllBetaFunctions::usage="";
 CountNumberOfParameters::usage="";
 CreateDisplayFunction::usage="";
+CreateBetaDisplayFunction::usage="creates assignment of the beta
+functions to the elements of the array pars";
 CreateSetFunction::usage="";
 CreateSetters::usage="";
 CreateGetters::usage="";
@@ -291,7 +293,7 @@ CollectBetaFunctionFutures[betaFunction_BetaFunction, loopOrder_Integer] :=
            If[Length[GetAllBetaFunctions[betaFunction]] >= loopOrder,
               name = ToValidCSymbolString[GetName[betaFunction]];
               betaName = "beta_" <> name;
-              result = betaName <> " += fut_" <> name <> ".get();\n";
+              result = betaName <> " += global_thread_pool().wait(fut_" <> name <> ");\n";
              ];
            result
           ];
@@ -437,6 +439,26 @@ CreateDisplayFunction[betaFunctions_List, parameterNumberOffset_:0] :=
            Return[display];
           ];
 
+(* assigns the local beta_<par> variables to the array pars *)
+CreateBetaDisplayFunction[betaFunctions_List, parameterNumberOffset_:0] :=
+    Module[{display = "", paramCount = parameterNumberOffset, name = "",
+            type = ErrorType, i, numberOfParameters, assignment = "",
+            nAssignments = 0},
+           numberOfParameters = CountNumberOfParameters[betaFunctions] + parameterNumberOffset;
+           For[i = 1, i <= Length[betaFunctions], i++,
+               type = GetType[betaFunctions[[i]]];
+               name = "beta_" <> ToValidCSymbolString[GetName[betaFunctions[[i]]]];
+               {assignment, nAssignments} = Parameters`CreateDisplayAssignment[name, paramCount, type];
+               display = display <> assignment;
+               paramCount += nAssignments;
+              ];
+           (* sanity check *)
+           If[paramCount != numberOfParameters,
+              Print["Error: CreateBetaDisplayFunction: number of parameters does not match: ", paramCount,
+                    " != ", numberOfParameters]; Quit[1];];
+           Return[display];
+          ];
+
 CreateParameterNames[betaFunctions_List] :=
     Module[{result},
            result = Utils`StringJoinWithSeparator[
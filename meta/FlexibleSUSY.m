@@ -195,6 +195,7 @@ UseHiggs3LoopSplit = False;
 UseYukawa3LoopQCD = Automatic;
 UseYukawa4LoopQCD = Automatic;
 FSRGELoopOrder = 2; (* RGE loop order (0, 1 or 2) *)
+UseFixedSizeRGEState = False; (* integrate RGEs with fixed-size state vector *)
 PotentialLSPParticles = {};
 ExtraSLHAOutputBlocks = {
     {FlexibleSUSYLowEnergy,
@@ -750,9 +751,10 @@ WriteRGEClass[betaFun_List, anomDim_List, files_List,
               additionalTraces_List:{}, numberOfBaseClassParameters_:0] :=
    Module[{beta, setter, getter, parameterDef, set,
            display,
+           displayBeta,
            cCtorParameterList, parameterCopyInit, betaParameterList,
            anomDimPrototypes, anomDimFunctions, printParameters, parameters,
-           numberOfParameters, clearParameters,
+           numberOfParameters, clearParameters, runRGEs,
            singleBetaFunctionsDecls, singleBetaFunctionsDefsFiles,
            traceDefs, calcTraces, sarahTraces},
           (* extract list of parameters from the beta functions *)
@@ -767,6 +769,7 @@ WriteRGEClass[betaFun_List, anomDim_List, files_List,
           parameterDef         = BetaFunction`CreateParameterDefinitions[betaFun];
           set                  = BetaFunction`CreateSetFunction[betaFun, numberOfBaseClassParameters];
           display              = BetaFunction`CreateDisplayFunction[betaFun, numberOfBaseClassParameters];
+          displayBeta          = BetaFunction`CreateBetaDisplayFunction[betaFun, numberOfBaseClassParameters];
           cCtorParameterList   = BetaFunction`CreateCCtorParameterList[betaFun];
           parameterCopyInit    = BetaFunction`CreateCCtorInitialization[betaFun];
           betaParameterList    = BetaFunction`CreateParameterList[betaFun, "beta_"];
@@ -774,6 +777,9 @@ WriteRGEClass[betaFun_List, anomDim_List, files_List,
           anomDimPrototypes    = AnomalousDimension`CreateAnomDimPrototypes[anomDim];
           anomDimFunctions     = AnomalousDimension`CreateAnomDimFunctions[anomDim];
           printParameters      = WriteOut`PrintParameters[parameters, "ostr"];
+          runRGEs              = If[FlexibleSUSY`UseFixedSizeRGEState === True,
+                                    "run_fixed_size<numberOfParameters>(x1, x2, eps);",
+                                    "Beta_function::run(x1, x2, eps);"];
           singleBetaFunctionsDecls = BetaFunction`CreateSingleBetaFunctionDecl[betaFun];
           traceDefs            = Traces`CreateTraceDefs[betaFun];
           traceDefs            = traceDefs <> Traces`CreateSARAHTraceDefs[sarahTraces];
@@ -783,6 +789,7 @@ WriteRGEClass[betaFun_List, anomDim_List, files_List,
                  { "@beta@"                 -> IndentText[WrapLines[beta]],
                    "@clearParameters@"      -> IndentText[WrapLines[clearParameters]],
                    "@display@"              -> IndentText[display],
+                   "@displayBeta@"          -> IndentText[displayBeta],
                    "@set@"                  -> IndentText[set],
                    "@cCtorParameterList@"   -> WrapLines[cCtorParameterList],
                    "@parameterCopyInit@"    -> WrapLines[parameterCopyInit],
@@ -795,6 +802,7 @@ WriteRGEClass[betaFun_List, anomDim_List, files_List,
                    "@anomDimFunctions@"     -> WrapLines[anomDimFunctions],
                    "@numberOfParameters@"   -> RValueToCFormString[numberOfParameters],
                    "@printParameters@"      -> IndentText[printParameters],
+                   "@runRGEs@"              -> IndentText[runRGEs],
                    "@singleBetaFunctionsDecls@" -> IndentText[singleBetaFunctionsDecls],
                    "@traceDefs@"            -> IndentText[IndentText[traceDefs]],
                    "@calc1LTraces@"         -> IndentText @ IndentText[WrapLines[calcTraces[[1]] <> "\n" <> calcTraces[[2]]]],
@@ -1527,7 +1535,8 @@ WriteModelClass[massMatrices_List, ewsbEquations_List,
             physicalMassesDef = "", mixingMatricesDef = "",
             massCalculationPrototypes = "", massCalculationFunctions = "",
             calculateAllMasses = "",
-            selfEnergyPrototypes = "", selfEnergyFunctions = "",
+            selfEnergyPrototypes = "", selfEnergyHelperPrototypes = "",
+            selfEnergyFunctions = "",
             twoLoopTadpolePrototypes = "", twoLoopTadpoleFunctions = "",
             twoLoopSelfEnergyPrototypes = "", twoLoopSelfEnergyFunctions = "",
             threeLoopSelfEnergyPrototypes = "", threeLoopSelfEnergyFunctions = "",
@@ -1642,7 +1651,8 @@ WriteModelClass[massMatrices_List, ewsbEquations_List,
               {secondGenerationHelperPrototypes, secondGenerationHelperFunctions} = TreeMasses`CreateGenerationHelpers[2];
               {thirdGenerationHelperPrototypes, thirdGenerationHelperFunctions} = TreeMasses`CreateGenerationHelpers[3];
              ];
-           {selfEnergyPrototypes, selfEnergyFunctions} = SelfEnergies`CreateNPointFunctions[nPointFunctions, vertexRules];
+           {selfEnergyPrototypes, selfEnergyHelperPrototypes, selfEnergyFunctions} =
+               SelfEnergies`CreateNPointFunctions[nPointFunctions, vertexRules];
            phasesDefinition             = Phases`CreatePhasesDefinition[phases];
            phasesGetterSetters          = Phases`CreatePhasesGetterSetters[phases];
            If[Parameters`GetExtraParameters[] =!= {},
@@ -1764,6 +1774,7 @@ WriteModelClass[massMatrices_List, ewsbEquations_List,
                             "@massCalculationFunctions@"  -> WrapLines[massCalculationFunctions],
                             "@calculateAllMasses@"        -> IndentText[calculateAllMasses],
                             "@selfEnergyPrototypes@"      -> IndentText[selfEnergyPrototypes],
+                            "@selfEnergyHelperPrototypes@" -> IndentText[selfEnergyHelperPrototypes],
                             "@selfEnergyFunctions@"       -> selfEnergyFunctions,
                             "@twoLoopTadpolePrototypes@"  -> IndentText[twoLoopTadpolePrototypes],
                             "@twoLoopTadpoleFunctions@"   -> twoLoopTadpoleFunctions,
@@ -2133,7 +2144,8 @@ RunEnabledSpectrumGenerator[solver_] :=
            class = GetBVPSolverTemplateParameter[solver];
            body = "exit_code = run_solver<" <> class <> ">(\n"
                   <> IndentText["slha_io, spectrum_generator_settings, slha_output_file,\n"]
-                  <> IndentText["database_output_file, spectrum_file, rgflow_file);\n"]
+                  <> IndentText["database_output_file, columnar_output_file,\n"]
+                  <> IndentText["spectrum_file, rgflow_file);\n"]
                   <> "if (!exit_code || solver_type != 0) break;\n";
            result = "case " <> key <> ":\n" <> IndentText[body];
            EnableForBVPSolver[solver, IndentText[result]] <> "\n"
@@ -2143,12 +2155,15 @@ ScanEnabledSpectrumGenerator[solver_] :=
     Module[{key = "", class = "", macro = "", body = "", result = ""},
            key = GetBVPSolverSLHAOptionKey[solver];
            class = GetBVPSolverTemplateParameter[solver];
-           body = "result = run_parameter_point<" <> class <> ">(qedqcd, input);\n"
+           body = "result = run_parameter_point<" <> class <> ">(qedqcd, input, guess, with_entry);\n"
                   <> "if (!result.problems.have_problem() || solver_type != 0) break;\n";
            result = "case " <> key <> ":\n" <> IndentText[body];
-           EnableForBVPSolver[solver, IndentText[IndentText[result]]] <> "\n"
+           EnableForBVPSolver[solver, IndentText[result]] <> "\n"
           ];
 
+ScanEnabledSolverType[solver_] :=
+    EnableForBVPSolver[solver, IndentText["case " <> GetBVPSolverSLHAOptionKey[solver] <> ":\n"]] <> "\n";
+
 RunCmdLineEnabledSpectrumGenerator[solver_] :=
     Module[{key = "", class = "", macro = "", body = "", result = ""},
            key = GetBVPSolverSLHAOptionKey[solver];
@@ -2162,13 +2177,14 @@ RunCmdLineEnabledSpectrumGenerator[solver_] :=
 WriteUserExample[inputParameters_List, files_List] :=
     Module[{parseCmdLineOptions, printCommandLineOptions, inputPars,
             solverIncludes = "", runEnabledSolvers = "", scanEnabledSolvers = "",
-            runEnabledCmdLineSolvers = "", defaultSolverType},
+            scanEnabledSolverTypes = "", runEnabledCmdLineSolvers = "", defaultSolverType},
            inputPars = {First[#], #[[3]]}& /@ inputParameters;
            parseCmdLineOptions = WriteOut`ParseCmdLineOptions[inputPars];
            printCommandLineOptions = WriteOut`PrintCmdLineOptions[inputPars];
            (solverIncludes = solverIncludes <> EnableSpectrumGenerator[#])& /@ FlexibleSUSY`FSBVPSolvers;
            (runEnabledSolvers = runEnabledSolvers <> RunEnabledSpectrumGenerator[#])& /@ FlexibleSUSY`FSBVPSolvers;
            (scanEnabledSolvers = scanEnabledSolvers <> ScanEnabledSpectrumGenerator[#])& /@ FlexibleSUSY`FSBVPSolvers;
+           (scanEnabledSolverTypes = scanEnabledSolverTypes <> ScanEnabledSolverType[#])& /@ FlexibleSUSY`FSBVPSolvers;
            (runEnabledCmdLineSolvers = runEnabledCmdLineSolvers <> RunCmdLineEnabledSpectrumGenerator[#])& /@ FlexibleSUSY`FSBVPSolvers;
            If[Length[FlexibleSUSY`FSBVPSolvers] == 0,
               defaultSolverType = "-1",
@@ -2180,6 +2196,7 @@ WriteUserExample[inputParameters_List, files_List] :=
                             "@solverIncludes@" -> solverIncludes,
                             "@runEnabledSolvers@" -> runEnabledSolvers,
                             "@scanEnabledSolvers@" -> scanEnabledSolvers,
+                            "@scanEnabledSolverTypes@" -> scanEnabledSolverTypes,
                             "@runEnabledCmdLineSolvers@" -> runEnabledCmdLineSolvers,
                             "@defaultSolverType@" -> defaultSolverType,
                             Sequence @@ GeneralReplacementRules[]
@@ -570,19 +570,43 @@ DoMediumDiagonalization[particle_Symbol /; IsScalar[particle], inputMomentum_, t
                     calcHigherLoopHiggsContributions = calcHigherLoopHiggsContributions <> CalcEffPot3L[particle];
                    ];
                 ];
-              result = tadpoleMatrix <>
-                       "const " <> selfEnergyMatrixCType <> " M_tree(" <> massMatrixStr <> "());\n" <>
-                       calcHigherLoopHiggsContributions <> "\n" <>
-                       "for (int es = 0; es < " <> dimStr <> "; ++es) {\n" <>
-                       IndentText["const double p = Abs(" <> momentum <> "(es));\n" <>
-                                  selfEnergyMatrixCType <> " self_energy = " <> CastIfReal[selfEnergyFunction <> "(p)", selfEnergyMatrixType] <> ";\n" <>
-                                  addHigherLoopHiggsContributions <>
-                                  "const " <> selfEnergyMatrixCType <> " M_loop(M_tree - self_energy" <>
-                                  If[tadpoleMatrix == "", "", " + tadpoles"] <> ");\n" <>
-                                  eigenArrayType <> " eigen_values;\n" <>
-                                  diagSnippet
-                                 ] <>
-                       "}\n";
+              If[Head[mixingMatrix] =!= List && mixingMatrix =!= Null,
+                 (* diagonalize all momentum-dependent mass matrices at once,
+                    starting from the tree-level mixing matrix *)
+                 result = tadpoleMatrix <>
+                          "const " <> selfEnergyMatrixCType <> " M_tree(" <> massMatrixStr <> "());\n" <>
+                          calcHigherLoopHiggsContributions <> "\n" <>
+                          "std::array<" <> selfEnergyMatrixCType <> ", " <> dimStr <> "> M_loop;\n\n" <>
+                          "for (int es = 0; es < " <> dimStr <> "; ++es) {\n" <>
+                          IndentText["const double p = Abs(" <> momentum <> "(es));\n" <>
+                                     selfEnergyMatrixCType <> " self_energy = " <> CastIfReal[selfEnergyFunction <> "(p)", selfEnergyMatrixType] <> ";\n" <>
+                                     addHigherLoopHiggsContributions <>
+                                     "M_loop[es] = M_tree - self_energy" <>
+                                     If[tadpoleMatrix == "", "", " + tadpoles"] <> ";\n"
+                                    ] <>
+                          "}\n\n" <>
+                          eigenArrayType <> " eigen_values;\n" <>
+                          mixingMatrixType <> " " <> Utemp <> "(" <> U <> ");\n" <>
+                          TreeMasses`CallDiagonalizeHermitianBatchFunction[
+                              particle, "M_loop", "eigen_values", Utemp,
+                              GetDimensionStartSkippingGoldstones[particle]-1] <> "\n" <>
+                          "PHYSICAL(" <> massName <> ") = SignedAbsSqrt(eigen_values);\n" <>
+                          "PHYSICAL(" <> U <> ") = " <> Utemp <> ";\n";
+                 ,
+                 result = tadpoleMatrix <>
+                          "const " <> selfEnergyMatrixCType <> " M_tree(" <> massMatrixStr <> "());\n" <>
+                          calcHigherLoopHiggsContributions <> "\n" <>
+                          "for (int es = 0; es < " <> dimStr <> "; ++es) {\n" <>
+                          IndentText["const double p = Abs(" <> momentum <> "(es));\n" <>
+                                     selfEnergyMatrixCType <> " self_energy = " <> CastIfReal[selfEnergyFunction <> "(p)", selfEnergyMatrixType] <> ";\n" <>
+                                     addHigherLoopHiggsContributions <>
+                                     "const " <> selfEnergyMatrixCType <> " M_loop(M_tree - self_energy" <>
+                                     If[tadpoleMatrix == "", "", " + tadpoles"] <> ");\n" <>
+                                     eigenArrayType <> " eigen_values;\n" <>
+                                     diagSnippet
+                                    ] <>
+                          "}\n";
+                ];
               ,
               result = tadpoleMatrix <>
                        "const " <> selfEnergyMatrixCType <> " M_tree(" <> massMatrixStr <> "());\n" <>
@@ -897,10 +921,11 @@ CreateLoopMassPrototype[particle_Symbol] :=
     "void " <> CreateLoopMassFunctionName[particle] <> "();\n";
 
 CreateLoopMassFunction[particle_Symbol, precision_Symbol, tadpole_] :=
-    Module[{result, body = ""},
+    Module[{result, body},
+           body = "PROFILE_SCOPE(\"" <> CreateLoopMassFunctionName[particle] <> "\");\n\n";
            If[!IsFermion[particle] &&
               !(IsUnmixed[particle] && GetMassOfUnmixedParticle[particle] === 0),
-              body = "if (!force_output && problems.is_running_tachyon(" <> FlexibleSUSY`FSModelName <> "_info::" <> ToValidCSymbolString[particle] <> "))\n" <>
+              body = body <> "if (!force_output && problems.is_running_tachyon(" <> FlexibleSUSY`FSModelName <> "_info::" <> ToValidCSymbolString[particle] <> "))\n" <>
                      IndentText["return;"] <> "\n\n";
              ];
            body = body <> DoDiagonalization[particle, precision, tadpole];
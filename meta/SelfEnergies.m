@@ -41,7 +41,8 @@ CreateVertexExpressions::usage="creates C/C++ functions for the
 given list of vertices";
 
 CreateNPointFunctions::usage="creates C/C++ functions for the
-given list of self-energies and tadpoles";
+given list of self-energies and tadpoles.  Returns the list {public
+prototypes, private prototypes, definitions}";
 
 CreateSelfEnergyFunctionName::usage="creates self-energy function name
 for a given field";
@@ -512,84 +513,186 @@ DecreaseLiteralCouplingIndices[expr_, num_:1] :=
            }
           ];
 
+(* applies the vertex rules and index conventions to the expression
+   of an n-point function *)
+PrepareNPointFunctionExpression[nPointFunction_, vertexRules_List] :=
+    DecreaseLiteralCouplingIndices[GetExpression[nPointFunction]] /.
+    vertexRules /.
+    a_[List[i__]] :> a[i] /.
+    ReplaceGhosts[FlexibleSUSY`FSEigenstates] /.
+    C -> 1;
+
 CreateNPointFunction[nPointFunction_, vertexRules_List] :=
     Module[{decl, expr, prototype, body, functionName},
-           expr = GetExpression[nPointFunction];
            functionName = CreateFunctionPrototype[nPointFunction, 1];
            type = CConversion`CreateCType[CConversion`ScalarType[CConversion`complexScalarCType]];
            prototype = type <> " " <> functionName <> ";\n";
            decl = "\n" <> type <> " CLASSNAME::" <> functionName <> "\n{\n";
            body = type <> " result;\n\n" <>
                   ExpressionToStringSequentially[
-                                     DecreaseLiteralCouplingIndices[expr] /.
-                                     vertexRules /.
-                                     a_[List[i__]] :> a[i] /.
-                                     ReplaceGhosts[FlexibleSUSY`FSEigenstates] /.
-                                     C -> 1,
-                                     TreeMasses`GetParticles[], "result"]  <>
+                      PrepareNPointFunctionExpression[nPointFunction, vertexRules],
+                      TreeMasses`GetParticles[], "result"]  <>
                   "\nreturn result * oneOver16PiSqr;";
            body = IndentText[WrapLines[body]];
            decl = decl <> body <> "\n}\n";
            Return[{prototype, decl}];
           ];
 
-CreateNPointFunctionMatrix[_SelfEnergies`Tadpole] := { "", "" };
+GetExternalFieldIndices[field_[i1_, i2_][_]] := {i1, i2};
+GetExternalFieldIndices[field_[i1_, i2_]] := {i1, i2};
+
+(* returns True if the symbol is a SARAH field index, e.g. gI1 or gO2 *)
+IsFieldIndexSymbol[s_Symbol] :=
+    Context[s] === "SARAH`" &&
+    StringMatchQ[SymbolName[s], ("gI" | "gO") ~~ DigitCharacter..];
+IsFieldIndexSymbol[_] := False;
+
+(* returns the {index, dimension} pairs of the field indices a loop
+   function depends on, or Null if the loop function cannot be
+   evaluated independently of the external field indices *)
+GetLoopFunctionIndices[loopFunction_, externalIndices_List] :=
+    Module[{lf, indices, rest},
+           If[!FreeQ[loopFunction, Alternatives @@ externalIndices], Return[Null]];
+           (* the SARAH expressions contain the masses as Mass2[f[idx]] *)
+           lf = loopFunction /. {
+               SARAH`Mass2[a_] :> FlexibleSUSY`M[a],
+               SARAH`Mass[a_]  :> FlexibleSUSY`M[a] };
+           indices = DeleteDuplicates @ Cases[lf,
+               FlexibleSUSY`M[((SARAH`bar|Susyno`LieGroups`conj)[f_[idx_Symbol]]) | f_[idx_Symbol]] :>
+                   {idx, TreeMasses`GetDimension[f]}, {0, Infinity}];
+           (* all indices must be field indices with a unique range *)
+           If[Length[DeleteDuplicates[First /@ indices]] != Length[indices],
+              Return[Null]];
+           (* no other field index may remain, e.g. in a mass of a
+              field with several indices or outside of a mass *)
+           rest = lf /. FlexibleSUSY`M[((SARAH`bar|Susyno`LieGroups`conj)[_[_Symbol]]) | _[_Symbol]] -> 0;
+           If[!FreeQ[rest, s_Symbol /; IsFieldIndexSymbol[s]],
+              Return[Null]];
+           indices
+          ];
+
+(* Replaces each distinct loop function call, which does not depend on
+   the external field indices, by an element of an array.  The
+   arrays are filled once per momentum.
 
-FillHermitianSelfEnergyMatrix[nPointFunction_, sym_String] :=
-    Module[{field = GetField[nPointFunction], dim, name},
-           dim = GetDimension[field];
-           name = CreateFunctionName[nPointFunction, 1];
-           "\
-for (int i = 0; i < " <> ToString[dim] <> "; i++)
-   for (int k = i; k < " <> ToString[dim] <> "; k++)
-      " <> sym <> "(i, k) = " <> name <> "(p, i, k);
-
-Hermitianize(" <> sym <> ");
-"
+   Return: {definitions_String, expr, parameters}, where parameters is
+   a list of {type, name} pairs of the hoisted loop function values
+ *)
+HoistLoopFunctions[expr_, externalIndices_List] :=
+    Module[{loopFunctions, defs = "", rules = {}, params = {}, k = 0, lf,
+            indices, name, dims, idxStr, fill, n, type},
+           loopFunctions = DeleteDuplicates @ Cases[expr,
+               (SARAH`A0 | SARAH`B0 | SARAH`B1 | SARAH`B00 | SARAH`B22 |
+                SARAH`F0 | SARAH`G0 | SARAH`H0)[__], {0, Infinity}];
+           Do[
+               indices = GetLoopFunctionIndices[lf, externalIndices];
+               If[indices === Null || Length[indices] > 2, Continue[]];
+               name = "lf" <> ToString[k++];
+               If[indices === {},
+                  defs = defs <> "const double " <> name <> " = " <>
+                         ExpressionToString[lf, TreeMasses`GetParticles[]] <> ";\n";
+                  AppendTo[rules, lf -> Symbol[name]];
+                  AppendTo[params, {"double", name}];
+                  ,
+                  dims = ToString /@ (Last /@ indices);
+                  idxStr = ToValidCSymbolString /@ (First /@ indices);
+                  type = "Eigen::Array<double," <> dims[[1]] <> "," <>
+                         If[Length[dims] > 1, dims[[2]], "1"] <> ">";
+                  fill = name <> "(" <> StringJoin[Riffle[idxStr, ","]] <> ") = " <>
+                         ExpressionToString[lf, TreeMasses`GetParticles[]] <> ";\n";
+                  Do[fill = "for (int " <> idxStr[[n]] <> " = 0; " <> idxStr[[n]] <>
+                            " < " <> dims[[n]] <> "; " <> idxStr[[n]] <> "++)\n" <>
+                            IndentText[fill],
+                     {n, Length[indices], 1, -1}];
+                  defs = defs <> type <> " " <> name <> ";\n" <> fill;
+                  AppendTo[rules, lf -> Symbol[name] @@ (First /@ indices)];
+                  AppendTo[params, {"const " <> type <> "&", name}];
+                 ];
+               , {lf, loopFunctions}];
+           {defs, expr /. rules, params}
           ];
 
-FillGeneralSelfEnergyFunction[nPointFunction_, sym_String] :=
-    Module[{field = GetField[nPointFunction], dim, name},
+DependsOnMomentum[expr_] :=
+    !FreeQ[expr, s_Symbol /; SymbolName[s] === "p"];
+
+CreateNPointFunctionKernelName[nPointFunction_] :=
+    CreateFunctionName[nPointFunction, 1] <> "_impl";
+
+(* Creates the self-energy of a multiplet with dim > 1 from three
+   parts: the element function self_energy_<X>_1loop(p, i, k) and the
+   matrix function self_energy_<X>_1loop(p) both evaluate the loop
+   functions, which do not depend on the external field indices, and
+   pass them to the private function self_energy_<X>_1loop_impl(),
+   which contains the expression of one matrix element.
+
+   Return: {public prototypes, private prototypes, definitions}
+ *)
+CreateNPointFunctionAndMatrix[nPointFunction_, vertexRules_List] :=
+    Module[{field = GetField[nPointFunction], dim, dimStr, hermitian,
+            indices, i, k, lfDefs, expr, params, withP, type, matrixType,
+            implName, implPrototype, implArgs, implCall, elementPrototype,
+            matrixPrototype, defs},
            dim = GetDimension[field];
-           name = CreateFunctionName[nPointFunction, 1];
-           "\
-for (int i = 0; i < " <> ToString[dim] <> "; i++)
-   for (int k = 0; k < " <> ToString[dim] <> "; k++)
-      " <> sym <> "(i, k) = " <> name <> "(p, i, k);
-"
-          ];
+           dimStr = ToString[dim];
+           hermitian = (IsScalar[field] || IsVector[field]) && SelfEnergyIsSymmetric[field];
+           indices = GetExternalFieldIndices[field];
+           {i, k} = ToValidCSymbolString /@ indices;
+           {lfDefs, expr, params} = HoistLoopFunctions[
+               PrepareNPointFunctionExpression[nPointFunction, vertexRules], indices];
+           lfDefs = WrapLines[lfDefs] <> If[lfDefs =!= "", "\n", ""];
+           withP = DependsOnMomentum[expr];
+           type = CConversion`CreateCType[CConversion`ScalarType[CConversion`complexScalarCType]];
+           matrixType = CConversion`CreateCType[CConversion`MatrixType[CConversion`complexScalarCType, dim, dim]];
+           implName = CreateNPointFunctionKernelName[nPointFunction];
+           implPrototype = implName <> "(" <>
+               StringJoin[Riffle[
+                   If[withP, {"double p"}, {}] ~Join~ {"int " <> i, "int " <> k} ~Join~
+                   ((#[[1]] <> " " <> #[[2]])& /@ params), ", "]] <> ") const";
+           implArgs[a_String, b_String] := implName <> "(" <>
+               StringJoin[Riffle[
+                   If[withP, {"p"}, {}] ~Join~ {a, b} ~Join~ (Last /@ params), ", "]] <> ")";
+           elementPrototype = CreateFunctionPrototype[nPointFunction, 1];
+           matrixPrototype = CreateFunctionPrototypeMatrix[nPointFunction, 1];
+           defs = "
+" <> type <> " CLASSNAME::" <> implPrototype <> "
+{
+" <> IndentText[WrapLines[
+    type <> " result;\n\n" <>
+    ExpressionToStringSequentially[expr, TreeMasses`GetParticles[], "result"] <>
+    "\nreturn result * oneOver16PiSqr;"]] <> "
+}
 
-FillSelfEnergyMatrix[nPointFunction_, sym_String] :=
-    Module[{particle = GetField[nPointFunction]},
-           Which[(IsScalar[particle] || IsVector[particle]) && SelfEnergyIsSymmetric[particle],
-                 FillHermitianSelfEnergyMatrix[nPointFunction, sym],
-                 True,
-                 FillGeneralSelfEnergyFunction[nPointFunction, sym]
-                ]
-          ];
+" <> type <> " CLASSNAME::" <> elementPrototype <> "
+{
+" <> IndentText[lfDefs <> "return " <> implArgs[i, k] <> ";"] <> "
+}
 
-CreateNPointFunctionMatrix[nPointFunction_] :=
-    Module[{dim, functionName, type, prototype, def},
-           dim = GetDimension[GetField[nPointFunction]];
-           If[dim == 1, Return[{ "", "" }]];
-           functionName = CreateFunctionPrototypeMatrix[nPointFunction, 1];
-           type = CConversion`CreateCType[CConversion`MatrixType[CConversion`complexScalarCType, dim, dim]];
-           prototype = type <> " " <> functionName <> ";\n";
-           def = "
-" <> type <> " CLASSNAME::" <> functionName <> "
+" <> matrixType <> " CLASSNAME::" <> matrixPrototype <> "
 {
-   " <> type <> " self_energy;
+   " <> matrixType <> " self_energy;
 
-" <> IndentText[FillSelfEnergyMatrix[nPointFunction, "self_energy"]] <> "
+" <> IndentText[lfDefs <>
+"for (int " <> i <> " = 0; " <> i <> " < " <> dimStr <> "; " <> i <> "++) {
+   for (int " <> k <> " = " <> If[hermitian, i, "0"] <> "; " <> k <> " < " <> dimStr <> "; " <> k <> "++) {
+      self_energy(" <> i <> ", " <> k <> ") = " <> implArgs[i, k] <> ";
+   }
+}
+" <> If[hermitian, "\nHermitianize(self_energy);\n", ""]] <> "
    return self_energy;
 }
 ";
-           { prototype, def }
+           {type <> " " <> elementPrototype <> ";\n" <>
+            matrixType <> " " <> matrixPrototype <> ";\n",
+            type <> " " <> implPrototype <> ";\n",
+            defs}
           ];
 
+HasSelfEnergyMatrix[_SelfEnergies`Tadpole] := False;
+HasSelfEnergyMatrix[nPointFunction_] := GetDimension[GetField[nPointFunction]] > 1;
+
 CreateNPointFunctions[nPointFunctions_List, vertexRules_List] :=
-    Module[{prototypes = "", defs = "", vertexFunctionNames = {}, p, d,
-            relevantVertexRules},
+    Module[{prototypes = "", privatePrototypes = "", defs = "",
+            vertexFunctionNames = {}, p, pp, d, relevantVertexRules},
            (* create coupling functions for all vertices in the list *)
            Print["Converting vertex functions ..."];
            (* extract vertex rules needed for the given nPointFunctions *)
@@ -600,15 +703,17 @@ CreateNPointFunctions[nPointFunctions_List, vertexRules_List] :=
            Utils`StartProgressBar[Dynamic[k], Length[nPointFunctions]];
            For[k = 1, k <= Length[nPointFunctions], k++,
                Utils`UpdateProgressBar[k, Length[nPointFunctions]];
-               {p,d} = CreateNPointFunction[nPointFunctions[[k]], vertexFunctionNames];
-               prototypes = prototypes <> p;
-               defs = defs <> d;
-               {p,d} = CreateNPointFunctionMatrix[nPointFunctions[[k]]];
+               If[HasSelfEnergyMatrix[nPointFunctions[[k]]],
+                  {p,pp,d} = CreateNPointFunctionAndMatrix[nPointFunctions[[k]], vertexFunctionNames];
+                  privatePrototypes = privatePrototypes <> pp;
+                  ,
+                  {p,d} = CreateNPointFunction[nPointFunctions[[k]], vertexFunctionNames];
+                 ];
                prototypes = prototypes <> p;
                defs = defs <> d;
               ];
            Utils`StopProgressBar[Length[nPointFunctions]];
-           {prototypes, defs}
+           {prototypes, privatePrototypes, defs}
           ];
 
 FillArrayWithLoopTadpoles[loopLevel_, higgsAndIdx_List, arrayName_String, sign_String:"-", struct_String:""] :=
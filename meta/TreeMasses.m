@@ -241,6 +241,7 @@ corresponding to a given goldstone boson";
 CallSVDFunction::usage="";
 CallDiagonalizeSymmetricFunction::usage="";
 CallDiagonalizeHermitianFunction::usage="";
+CallDiagonalizeHermitianBatchFunction::usage="";
 
 FlagPoleTachyon::usage = "";
 FlagRunningTachyon::usage = "";
@@ -1490,14 +1491,14 @@ fs_svd(" <> matrix <> ", " <> eigenvalue <> ", " <> U <> ", " <> V <> ");"] <> "
 #endif
 ";
 
-CallDiagonalizationFunction[particle_, matrix_String, eigenvalue_String, U_String, function_String] :=
+CallDiagonalizationFunction[particle_, matrix_String, eigenvalue_String, U_String, function_String, args_String:""] :=
 "#ifdef CHECK_EIGENVALUE_ERROR
 " <> IndentText[
 "double eigenvalue_error;
-" <> function <> "(" <> matrix <> ", " <> eigenvalue <> ", " <> U <> ", eigenvalue_error);\n" <>
+" <> function <> "(" <> matrix <> ", " <> eigenvalue <> ", " <> U <> args <> ", eigenvalue_error);\n" <>
     If[ContainsMassless[particle],"",FlagBadMass[particle, eigenvalue]]
 ] <> "#else
-" <> IndentText["\n" <> function <> "(" <> matrix <> ", " <> eigenvalue <> ", " <> U <> ");\n"
+" <> IndentText["\n" <> function <> "(" <> matrix <> ", " <> eigenvalue <> ", " <> U <> args <> ");\n"
 ] <> "#endif\n" <>
 IndentText[
     If[IsVector[particle], U <> ".transposeInPlace();\n", ""] <>
@@ -1510,6 +1511,9 @@ CallDiagonalizeSymmetricFunction[particle_, matrix_String, eigenvector_String, U
 CallDiagonalizeHermitianFunction[particle_, matrix_String, eigenvector_String, U_String] :=
     CallDiagonalizationFunction[particle, matrix, eigenvector, U, "fs_diagonalize_hermitian"];
 
+CallDiagonalizeHermitianBatchFunction[particle_, matrices_String, eigenvector_String, U_String, idx_Integer] :=
+    CallDiagonalizationFunction[particle, matrices, eigenvector, U, "fs_diagonalize_hermitian_batch", ", " <> ToString[idx]];
+
 AssignVectorBosonMassesFrom[eigenVector_List] :=
     Module[{i, ev, result = ""},
            ev = CConversion`ToValidCSymbolString[FlexibleSUSY`M[CConversion`GetHead[MakeESSymbol[eigenVector]]]];
@@ -236,6 +236,24 @@ int Standard_model::get_pole_mass_loop_order() const
    return pole_mass_loop_order;
 }
 
+/**
+ * Sets the method to solve the equations for (rho-hat, sin(theta_w))
+ * in calculate_theta_w().  The default is the plain fixed-point
+ * iteration.
+ *
+ * @param method iteration method
+ */
+void Standard_model::set_weinberg_angle_iteration_method(
+   weinberg_angle::Weinberg_angle::Iteration_method method)
+{
+   weinberg_angle_iteration_method = method;
+}
+
+weinberg_angle::Weinberg_angle::Iteration_method Standard_model::get_weinberg_angle_iteration_method() const
+{
+   return weinberg_angle_iteration_method;
+}
+
 void Standard_model::set_ewsb_iteration_precision(double precision)
 {
    ewsb_iteration_precision = precision;
@@ -964,6 +982,7 @@ double Standard_model::calculate_theta_w(const softsusy::QedQcd& qedqcd, double
    Weinberg_angle weinberg;
    weinberg.disable_susy_contributions();
    weinberg.set_number_of_loops(threshold_corrections.sin_theta_w);
+   weinberg.set_iteration_method(weinberg_angle_iteration_method);
    weinberg.set_data(data);
 
    const int error = weinberg.calculate();
@@ -33,6 +33,7 @@
 #include "error.hpp"
 #include "problems.hpp"
 #include "physical_input.hpp"
+#include "weinberg_angle.hpp"
 
 #include <array>
 #include <iosfwd>
@@ -153,6 +154,8 @@ public:
    const Threshold_corrections& get_threshold_corrections() const;
    void set_pole_mass_loop_order(int);
    int get_pole_mass_loop_order() const;
+   void set_weinberg_angle_iteration_method(weinberg_angle::Weinberg_angle::Iteration_method);
+   weinberg_angle::Weinberg_angle::Iteration_method get_weinberg_angle_iteration_method() const;
    void set_physical(const Standard_model_physical&);
    double get_ewsb_iteration_precision() const;
    double get_ewsb_loop_order() const;
@@ -618,6 +621,8 @@ private:
                      &standard_model_info::parameter_names_getter};
    Loop_corrections loop_corrections{}; ///< used loop pole mass corrections
    Threshold_corrections threshold_corrections{}; ///< used low-energy threshold corrections
+   weinberg_angle::Weinberg_angle::Iteration_method weinberg_angle_iteration_method{
+      weinberg_angle::Weinberg_angle::Iteration_method::fixed_point}; ///< method to calculate sin(theta_w)
    Physical_input input{};
 
    int get_number_of_ewsb_iterations() const;
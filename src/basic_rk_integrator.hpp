@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <type_traits>
 
 #include "rk.hpp"
 
@@ -114,10 +115,18 @@ template <typename StateType,
           typename Stepper = Basic_rk_stepper<StateType,Derivs> >
 class Basic_rk_integrator {
 public:
+   /// function writing the derivatives into its last argument
+   using Derivs_in_place = std::function<void(double, const StateType&, StateType&)>;
+
    /// @brief Integrates the system over an interval
    void operator()(double start, double end, StateType& ystart,
                    Derivs derivs, double tolerance) const;
 
+   /// @brief Integrates the system over an interval without
+   /// allocating memory in each step
+   void operator()(double start, double end, StateType& ystart,
+                   const Derivs_in_place& derivs, double tolerance) const;
+
    /// @brief Sets the maximum number of allowed steps in the integration
    /// @param s maximum number of steps to allow
    void set_max_steps(int s) { max_steps = s; }
@@ -150,6 +159,16 @@ void Basic_rk_integrator<StateType, Derivs, Stepper>::operator()(
 {
    const double guess = (start - end) * 0.1; // first step size
    const double hmin = (start - end) * tolerance * 1.0e-5;
+
+   // the default stepper is replaced by an Ode_stepper, which
+   // allocates its temporaries once per integration
+   if (std::is_same<Stepper, Basic_rk_stepper<StateType,Derivs> >::value) {
+      Ode_stepper<StateType> ode_stepper(ystart.size());
+      integrateOdes(ystart, start, end, tolerance, guess, hmin,
+                    derivs, std::ref(ode_stepper), max_steps);
+      return;
+   }
+
    const auto rkqs = [this] (
       StateType& y, const StateType& dydx, double& x, double htry,
       double eps, const StateType& yscal, Derivs derivs,
@@ -162,6 +181,32 @@ void Basic_rk_integrator<StateType, Derivs, Stepper>::operator()(
                  derivs, rkqs, max_steps);
 }
 
+/**
+ * The vector of the initial values of the parameters is
+ * updated so that after calling this function, this vector contains
+ * the updated values of the parameters at the end-point of the
+ * integration.  The derivatives are written by \c derivs into a
+ * pre-allocated array, so no memory is allocated in the
+ * Runge-Kutta steps.  The stepper is not used in this case.
+ *
+ * @param[in] start initial value of the independent variable
+ * @param[in] end final value of the independent variable
+ * @param[inout] ystart initial values of the parameters
+ * @param[in] derivs function writing the derivatives into its last argument
+ * @param[in] tolerance desired accuracy to use in integration step
+ */
+template <typename StateType, typename Derivs, typename Stepper>
+void Basic_rk_integrator<StateType, Derivs, Stepper>::operator()(
+   double start, double end, StateType& ystart,
+   const Derivs_in_place& derivs, double tolerance) const
+{
+   const double guess = (start - end) * 0.1; // first step size
+   const double hmin = (start - end) * tolerance * 1.0e-5;
+
+   integrateOdesInPlace(ystart, start, end, tolerance, guess, hmin,
+                        std::cref(derivs), max_steps);
+}
+
 } // namespace runge_kutta
 
 } // namespace flexiblesusy
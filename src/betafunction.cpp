@@ -24,7 +24,10 @@
 #include "betafunction.hpp"
 #include "error.hpp"
 #include "logger.hpp"
+#include "profiling.hpp"
 
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
 
 namespace flexiblesusy {
@@ -38,6 +41,29 @@ void Beta_function::reset()
    tolerance = 1.e-4;
    min_tolerance = 1.0e-11;
    zero_threshold = 1.e-11;
+   record_trajectory = false;
+   trajectory.reset();
+}
+
+/**
+ * Sets an integrator, which expects the derivatives in the form
+ * derivs(x, y) -> dydx.  The derivatives are adapted to this form,
+ * which creates a temporary array in each evaluation.
+ *
+ * @param i integrator
+ */
+void Beta_function::set_integrator(const ODE_integrator& i)
+{
+   integrator = [i] (double x1, double x2, Eigen::ArrayXd& y,
+                     const Derivs_in_place& derivs, double eps) {
+      const Derivs d = [&derivs] (double x, const Eigen::ArrayXd& y) {
+         Eigen::ArrayXd dydx(y.size());
+         derivs(x, y, dydx);
+         return dydx;
+      };
+      i(x1, x2, y, d, eps);
+   };
+   default_integrator = false;
 }
 
 /**
@@ -63,43 +89,111 @@ void Beta_function::run_to(double x2, double eps)
  */
 void Beta_function::run(double x1, double x2, double eps)
 {
+   PROFILE_SCOPE("RG running");
+
    if (get_loops() > 0) {
       const double tol = get_tolerance(eps);
 
-      if (std::fabs(x1) < tol)
-         throw NonPerturbativeRunningError(x1);
-      if (std::fabs(x2) < tol)
-         throw NonPerturbativeRunningError(x2);
+      check_scales(x1, x2, tol);
 
       Eigen::ArrayXd y(get());
 
-      Derivs derivs = [this] (double x, const Eigen::ArrayXd& y) {
-         return derivatives(x, y);
+      const Derivs_in_place derivs = [this] (double x, const Eigen::ArrayXd& y, Eigen::ArrayXd& dydx) {
+         derivatives(x, y, dydx);
       };
 
-      call_rk(x1, x2, y, derivs, tol);
+      if (!interpolate_trajectory(x1, x2, y, tol)) {
+         if (record_trajectory) {
+            record_rk(x1, x2, y, derivs, tol);
+         } else {
+            call_rk(x1, x2, y, derivs, tol);
+         }
+      }
       set(y);
    }
 
    set_scale(x2);
 }
 
+/**
+ * Integrates the given system of ODEs from scale x1 to scale x2 with
+ * the running precision and the integrator of this object, as run()
+ * integrates the RGEs.  If the number of loops is zero, y is not
+ * modified.  The scale and the parameters of this object are not
+ * changed.
+ *
+ * @param x1 renormalization scale to start the integration from
+ * @param x2 renormalization scale to integrate to
+ * @param y state vector (input and output)
+ * @param derivs function which calculates the derivatives w.r.t. the
+ * logarithm of the renormalization scale
+ * @param eps RG running precision
+ */
+void Beta_function::integrate(double x1, double x2, Eigen::ArrayXd& y,
+                              const Derivs_in_place& derivs, double eps) const
+{
+   if (get_loops() <= 0)
+      return;
+
+   const double tol = get_tolerance(eps);
+
+   check_scales(x1, x2, tol);
+
+   if (std::fabs(x1 - x2) < min_tolerance)
+      return;
+
+   integrator(std::log(std::fabs(x1)), std::log(std::fabs(x2)), y, derivs, tol);
+}
+
+/**
+ * Writes the parameters into the given array.  This default
+ * implementation calls get() and copies the result.
+ *
+ * @param pars array of parameters (must have the correct size)
+ */
+void Beta_function::fill_parameters(Eigen::Ref<Eigen::ArrayXd> pars) const
+{
+   pars = get();
+}
+
+/**
+ * Sets the parameters from the given array.  This default
+ * implementation copies the array and calls set().
+ *
+ * @param pars array of parameters
+ */
+void Beta_function::set_parameters(const Eigen::Ref<const Eigen::ArrayXd>& pars)
+{
+   set(pars);
+}
+
+/**
+ * Writes the beta functions into the given array.  This default
+ * implementation calls beta() and copies the result.
+ *
+ * @param dydx array of beta functions (must have the correct size)
+ */
+void Beta_function::fill_beta(Eigen::Ref<Eigen::ArrayXd> dydx) const
+{
+   dydx = beta();
+}
+
 /**
  * Takes logarithm of renormalisation scale as first argument and
  * parameters of RGE passed in as an Eigen::ArrayXd object of dynamic
- * size in the second argument.  Returns the beta functions as an
- * Eigen::ArrayXd object.
+ * size in the second argument.  The beta functions are written into
+ * the third argument.
  *
  * @param x logarithm of renormalization scale to calculate beta functions at
  * @param y array of model parameters
- *
- * @return array of beta functions
+ * @param dydx array of beta functions (output)
  */
-Eigen::ArrayXd Beta_function::derivatives(double x, const Eigen::ArrayXd& y)
+void Beta_function::derivatives(double x, const Eigen::ArrayXd& y, Eigen::ArrayXd& dydx)
 {
    set_scale(exp(x));
    set(y);
-   return beta();
+   dydx.resize(y.size());
+   fill_beta(dydx);
 }
 
 /**
@@ -117,7 +211,7 @@ Eigen::ArrayXd Beta_function::derivatives(double x, const Eigen::ArrayXd& y)
  * @param eps RG running precision
  */
 void Beta_function::call_rk(double x1, double x2, Eigen::ArrayXd & v,
-                            Derivs derivs, double eps)
+                            const Derivs_in_place& derivs, double eps)
 {
    if (fabs(x1 - x2) < min_tolerance)
       return;
@@ -143,7 +237,7 @@ void Beta_function::call_rk(double x1, double x2, Eigen::ArrayXd & v,
  *
  * @return RG running precision
  */
-double Beta_function::get_tolerance(double eps)
+double Beta_function::get_tolerance(double eps) const
 {
    double tol;
    if (eps < 0.0)
@@ -156,4 +250,118 @@ double Beta_function::get_tolerance(double eps)
    return tol;
 }
 
+/**
+ * Throws a NonPerturbativeRunningError if one of the scales x1 and
+ * x2 is smaller than the RG running precision.
+ *
+ * @param x1 renormalization scale to start RG running from
+ * @param x2 renormalization scale to run parameters to
+ * @param tol RG running precision
+ */
+void Beta_function::check_scales(double x1, double x2, double tol)
+{
+   if (std::fabs(x1) < tol)
+      throw NonPerturbativeRunningError(x1);
+   if (std::fabs(x2) < tol)
+      throw NonPerturbativeRunningError(x2);
+}
+
+/**
+ * Interpolates the parameters from scale x1 to scale x2 using the
+ * recorded trajectory.  The interpolation is performed only if the
+ * trajectory has been recorded with the current settings and at
+ * least the requested precision, if both scales lie within the
+ * recorded interval and if the parameters v at the scale x1 lie on
+ * the recorded trajectory.
+ *
+ * @param x1 renormalization scale to start RG running from
+ * @param x2 renormalization scale to run parameters to
+ * @param v array of model parameters
+ * @param eps RG running precision
+ *
+ * @return true if the parameters have been interpolated, false otherwise
+ */
+bool Beta_function::interpolate_trajectory(
+   double x1, double x2, Eigen::ArrayXd& v, double eps) const
+{
+   if (!trajectory || trajectory->empty()) {
+      return false;
+   }
+
+   const auto& t = *trajectory;
+
+   if (t.get_loops() != loops || t.get_thresholds() != thresholds ||
+       t.get_zero_threshold() != zero_threshold || t.get_precision() > eps) {
+      return false;
+   }
+
+   const double start = std::log(std::fabs(x1));
+   const double end = std::log(std::fabs(x2));
+
+   if (!t.contains(start) || !t.contains(end)) {
+      return false;
+   }
+
+   const Eigen::ArrayXd v1 = t.interpolate(start);
+
+   if (v1.size() != v.size() ||
+       ((v1 - v).abs() > 16*DBL_EPSILON*v1.abs().max(v.abs())).any()) {
+      return false;
+   }
+
+   v = t.interpolate(end);
+
+   return true;
+}
+
+/**
+ * Integrates the RGEs from scale x1 to scale x2, as call_rk(), and
+ * records the trajectory.  The previously recorded trajectory is
+ * replaced if the integration succeeds.  The recording uses the
+ * built-in Runge-Kutta integrator, independent of the integrator set
+ * by set_integrator().
+ *
+ * @param x1 renormalization scale to start RG running from
+ * @param x2 renormalization scale to run parameters to
+ * @param v array of model parameters
+ * @param derivs function which calculates the derivatives (beta functions)
+ * @param eps RG running precision
+ */
+void Beta_function::record_rk(double x1, double x2, Eigen::ArrayXd& v,
+                              const Derivs_in_place& derivs, double eps)
+{
+   if (std::fabs(x1 - x2) < min_tolerance)
+      return;
+
+   const double start = std::log(std::fabs(x1));
+   const double end = std::log(std::fabs(x2));
+   const double tol = get_tolerance(eps);
+   const double guess = (start - end) * 0.1; // first step size
+   const double hmin = (start - end) * tol * 1.0e-5;
+
+   auto new_trajectory = std::make_shared<RG_trajectory>();
+   Eigen::ArrayXd ytmp(v.size()), dydx(v.size()), d2ydx2(v.size());
+
+   // stores the node, the second derivatives are obtained from a
+   // finite difference along the trajectory
+   const auto observer = [&] (double x, const Eigen::ArrayXd& y,
+                              const Eigen::ArrayXd& dy) {
+      const double delta = std::sqrt(DBL_EPSILON) * std::max(1., std::fabs(x));
+      ytmp = y + delta * dy;
+      derivs(x + delta, ytmp, d2ydx2);
+      d2ydx2 = (d2ydx2 - dy) / delta;
+      new_trajectory->add(x, y, dy, d2ydx2);
+   };
+
+   runge_kutta::integrateOdesInPlace(v, start, end, tol, guess, hmin,
+                                     std::cref(derivs), 400, std::cref(observer));
+
+   // add end-point
+   derivs(end, v, dydx);
+   observer(end, v, dydx);
+   new_trajectory->set_settings(tol, loops, thresholds, zero_threshold);
+
+   trajectory = std::move(new_trajectory);
+}
+
 } // namespace flexiblesusy
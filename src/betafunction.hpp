@@ -25,6 +25,12 @@
 #define BETAFUNCTION_H
 
 #include "basic_rk_integrator.hpp"
+#include "error.hpp"
+#include "profiling.hpp"
+#include "rg_trajectory.hpp"
+
+#include <cmath>
+#include <memory>
 
 #include <Eigen/Core>
 
@@ -39,11 +45,51 @@ namespace flexiblesusy {
  * basic RG running interface.  The run() and run_to() functions use
  * the Runge-Kutta algorithm to integrate the RGEs up to a given
  * scale.
+ *
+ * During the integration the beta functions are obtained from
+ * fill_beta(), which writes them into a pre-allocated array.  The
+ * default implementation copies the result of beta().  The generated
+ * parameter classes override fill_beta() such that no temporary
+ * objects are created, and their fill_beta() does not call beta().
+ * Therefore, classes derived from a generated model which modify the
+ * beta functions must override fill_beta(), see
+ * examples/customized-betas/.  The beta() function of the generated
+ * soft-breaking parameter classes is final and returns the result of
+ * fill_beta(), s.t. an override of beta() results in a compile
+ * error.
+ *
+ * A custom integrator can be set with set_integrator_in_place(),
+ * which receives the derivatives in the form derivs(x, y, dydx).
+ * Integrators of the form derivs(x, y) -> dydx can still be set with
+ * set_integrator(), at the expense of one temporary array per
+ * evaluation of the beta functions.
+ *
+ * Systems of ODEs other than the RGEs of the object, e.g. the RGEs
+ * of several parameter points at once, can be integrated with
+ * integrate(), which uses the running precision and the integrator
+ * of the object, as run() does.
+ *
+ * If trajectory recording is enabled, run() stores the accepted
+ * Runge-Kutta steps of the integration as an RG_trajectory.
+ * Subsequent calls of run() and run_to() which start on the recorded
+ * trajectory and stay within the recorded interval interpolate the
+ * parameters instead of integrating the RGEs again.  Copies of the
+ * object share the recorded trajectory.
+ *
+ * Derived classes which know the number of parameters at compile
+ * time can override run() and call run_fixed_size(), which
+ * integrates the RGEs with a fixed-size state vector.  For this the
+ * parameters are read and written with fill_parameters() and
+ * set_parameters(), which should be overridden to avoid temporary
+ * arrays of dynamic size.
  */
 class Beta_function {
 public:
    using Derivs = std::function<Eigen::ArrayXd(double, const Eigen::ArrayXd&)>;
    using ODE_integrator = std::function<void(double, double, Eigen::ArrayXd&, Derivs, double)>;
+   /// function writing the derivatives into its last argument
+   using Derivs_in_place = std::function<void(double, const Eigen::ArrayXd&, Eigen::ArrayXd&)>;
+   using ODE_integrator_in_place = std::function<void(double, double, Eigen::ArrayXd&, const Derivs_in_place&, double)>;
 
    Beta_function() = default;
    Beta_function(const Beta_function&) = default;
@@ -57,25 +103,38 @@ public:
    void set_loops(int l) { loops = l; }
    void set_thresholds(int t) { thresholds = t; }
    void set_zero_threshold(double t) { zero_threshold = t; }
-   void set_integrator(const ODE_integrator& i) { integrator = i; }
+   void set_integrator(const ODE_integrator&);
+   void set_integrator_in_place(const ODE_integrator_in_place& i) { integrator = i; default_integrator = false; }
+   void set_trajectory_recording(bool r) { record_trajectory = r; }
 
    double get_scale() const { return scale; }
    int get_number_of_parameters() const { return num_pars; }
    int get_loops() const { return loops; }
    int get_thresholds() const { return thresholds; }
    double get_zero_threshold() const { return zero_threshold; }
+   double get_min_tolerance() const { return min_tolerance; }
+   bool get_trajectory_recording() const { return record_trajectory; }
+   bool has_default_integrator() const { return default_integrator; }
+   const RG_trajectory* get_trajectory() const { return trajectory.get(); }
 
+   void clear_trajectory() { trajectory.reset(); }
    void reset();
 
    virtual Eigen::ArrayXd get() const = 0;
    virtual void set(const Eigen::ArrayXd&) = 0;
+   virtual void fill_parameters(Eigen::Ref<Eigen::ArrayXd>) const;
+   virtual void set_parameters(const Eigen::Ref<const Eigen::ArrayXd>&);
    virtual Eigen::ArrayXd beta() const = 0;
+   virtual void fill_beta(Eigen::Ref<Eigen::ArrayXd>) const;
 
    virtual void run(double, double, double eps = -1.0);
    virtual void run_to(double, double eps = -1.0);
+   void integrate(double, double, Eigen::ArrayXd&, const Derivs_in_place&, double eps = -1.0) const;
 
 protected:
-   void call_rk(double, double, Eigen::ArrayXd&, Derivs, double eps = -1.0);
+   void call_rk(double, double, Eigen::ArrayXd&, const Derivs_in_place&, double eps = -1.0);
+   template <int N>
+   void run_fixed_size(double, double, double eps = -1.0);
 
 private:
    int num_pars{0};              ///< number of parameters
@@ -85,13 +144,71 @@ private:
    double tolerance{1.e-4};      ///< running tolerance
    double min_tolerance{1.e-11}; ///< minimum tolerance allowed
    double zero_threshold{1.e-11};///< threshold for treating values as zero
-   ODE_integrator integrator{
+   ODE_integrator_in_place integrator{
       runge_kutta::Basic_rk_integrator<Eigen::ArrayXd>()};
-
-   Eigen::ArrayXd derivatives(double, const Eigen::ArrayXd&);
-   double get_tolerance(double eps);
+   bool default_integrator{true}; ///< integrator has not been replaced
+   bool record_trajectory{false}; ///< record trajectory in run()
+   std::shared_ptr<const RG_trajectory> trajectory{}; ///< recorded trajectory
+
+   void derivatives(double, const Eigen::ArrayXd&, Eigen::ArrayXd&);
+   double get_tolerance(double eps) const;
+   static void check_scales(double, double, double);
+   bool interpolate_trajectory(double, double, Eigen::ArrayXd&, double) const;
+   void record_rk(double, double, Eigen::ArrayXd&, const Derivs_in_place&, double);
 };
 
+/**
+ * Runs the parameters from scale x1 to scale x2, as run(), but with a
+ * state vector of fixed size N, s.t. the temporaries of the
+ * Runge-Kutta integration live on the stack and the loops over the
+ * parameters can be unrolled and vectorized.  Falls back to
+ * Beta_function::run() if the number of parameters is not N, a
+ * custom integrator has been set or an RG trajectory is used.
+ *
+ * @tparam N number of parameters
+ * @param x1 renormalization scale to start RG running from
+ * @param x2 renormalization scale to run parameters to
+ * @param eps RG running precision
+ */
+template <int N>
+void Beta_function::run_fixed_size(double x1, double x2, double eps)
+{
+   if (num_pars != N || !default_integrator || record_trajectory || trajectory) {
+      Beta_function::run(x1, x2, eps);
+      return;
+   }
+
+   PROFILE_SCOPE("RG running");
+
+   using State_t = Eigen::Array<double,N,1>;
+
+   if (get_loops() > 0) {
+      const double tol = get_tolerance(eps);
+
+      check_scales(x1, x2, tol);
+
+      if (std::fabs(x1 - x2) >= min_tolerance) {
+         State_t y;
+         fill_parameters(y);
+
+         const auto derivs = [this] (double x, const State_t& y, State_t& dydx) {
+            set_scale(std::exp(x));
+            set_parameters(y);
+            fill_beta(dydx);
+         };
+
+         runge_kutta::Basic_rk_integrator<State_t> integrator;
+         integrator(std::log(std::fabs(x1)), std::log(std::fabs(x2)), y,
+                    typename runge_kutta::Basic_rk_integrator<State_t>::Derivs_in_place(derivs),
+                    tol);
+
+         set_parameters(y);
+      }
+   }
+
+   set_scale(x2);
+}
+
 } // namespace flexiblesusy
 
 #endif
@@ -0,0 +1,409 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+/**
+ * @file columnar_io.cpp
+ * @brief contains implementation of Columnar_writer and Columnar_reader
+ */
+
+#include "columnar_io.hpp"
+#include "error.hpp"
+#include "logger.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace flexiblesusy {
+namespace columnar {
+
+namespace {
+
+const char magic[8] = {'F','S','C','O','L','U','M','N'};
+const std::uint64_t version = 1;
+
+std::size_t padding(std::size_t n)
+{
+   return (8 - n % 8) % 8;
+}
+
+void write_uint64(std::ostream& ostr, std::uint64_t n)
+{
+   ostr.write(reinterpret_cast<const char*>(&n), sizeof(n));
+}
+
+bool read_uint64(std::istream& istr, std::uint64_t& n)
+{
+   return static_cast<bool>(istr.read(reinterpret_cast<char*>(&n), sizeof(n)));
+}
+
+/// reads the column names from the header, returns false if the file
+/// is not a columnar file
+bool read_header(std::istream& istr, std::vector<std::string>& names)
+{
+   char buf[8];
+   std::uint64_t file_version = 0, number_of_columns = 0;
+
+   if (!istr.read(buf, sizeof(buf)) || std::memcmp(buf, magic, sizeof(magic)) != 0 ||
+       !read_uint64(istr, file_version) || file_version != version ||
+       !read_uint64(istr, number_of_columns)) {
+      return false;
+   }
+
+   names.clear();
+   names.reserve(number_of_columns);
+
+   for (std::uint64_t i = 0; i < number_of_columns; i++) {
+      std::uint64_t length = 0;
+      if (!read_uint64(istr, length)) {
+         return false;
+      }
+      std::string name(length, '\0');
+      if (!istr.read(&name[0], length) || !istr.ignore(padding(length))) {
+         return false;
+      }
+      names.push_back(std::move(name));
+   }
+
+   return true;
+}
+
+void write_header(std::ostream& ostr, const std::vector<std::string>& names)
+{
+   const char zeros[8] = {};
+
+   ostr.write(magic, sizeof(magic));
+   write_uint64(ostr, version);
+   write_uint64(ostr, names.size());
+
+   for (const auto& name: names) {
+      write_uint64(ostr, name.size());
+      ostr.write(name.data(), name.size());
+      ostr.write(zeros, padding(name.size()));
+   }
+}
+
+/// exclusive lock of a file during the lifetime of the object
+class File_lock {
+public:
+   explicit File_lock(int fd_) : fd(fd_)
+   {
+      while (flock(fd, LOCK_EX) != 0) {
+         if (errno != EINTR) {
+            throw SetupError(std::string("Columnar_writer: cannot lock file: ") +
+                             std::strerror(errno));
+         }
+      }
+   }
+   File_lock(const File_lock&) = delete;
+   File_lock& operator=(const File_lock&) = delete;
+   ~File_lock() { flock(fd, LOCK_UN); }
+
+private:
+   int fd;
+};
+
+std::uint64_t file_size(int fd)
+{
+   struct stat st;
+
+   if (fstat(fd, &st) != 0) {
+      throw SetupError(std::string("Columnar_writer: cannot determine file size: ") +
+                       std::strerror(errno));
+   }
+
+   return st.st_size;
+}
+
+} // anonymous namespace
+
+/**
+ * Opens the file for appending.  If the file does not exist or is
+ * empty, the header is written.  Otherwise the header is checked and
+ * an incomplete chunk at the end of the file is removed.
+ *
+ * @param file_name_ file name
+ * @param names column names
+ * @param rows_per_chunk_ number of rows written per chunk
+ */
+Columnar_writer::Columnar_writer(
+   const std::string& file_name_, const std::vector<std::string>& names,
+   std::size_t rows_per_chunk_)
+   : file_name(file_name_)
+   , number_of_columns(names.size())
+   , rows_per_chunk(rows_per_chunk_ > 0 ? rows_per_chunk_ : 1)
+   , buffer(rows_per_chunk, names.size())
+{
+   fd = ::open(file_name.c_str(), O_RDWR | O_CREAT, 0644);
+
+   if (fd < 0) {
+      throw SetupError("Columnar_writer: cannot open " + file_name);
+   }
+
+   try {
+      File_lock lock(fd);
+
+      if (file_size(fd) == 0) {
+         std::ostringstream header;
+         write_header(header, names);
+         const std::string str(header.str());
+         write(str.data(), str.size());
+      } else {
+         std::ifstream istr(file_name, std::ios::binary);
+         std::vector<std::string> existing_names;
+         if (!read_header(istr, existing_names)) {
+            throw ReadError("Columnar_writer: " + file_name +
+                            " is not a columnar output file");
+         }
+         if (existing_names != names) {
+            throw SetupError("Columnar_writer: columns of " + file_name +
+                             " do not match");
+         }
+         end_of_data = istr.tellg();
+         remove_incomplete_chunk();
+      }
+   } catch (...) {
+      ::close(fd);
+      throw;
+   }
+}
+
+Columnar_writer::~Columnar_writer()
+{
+   try {
+      flush();
+   } catch (...) {
+      ERROR("Columnar_writer: writing the remaining rows failed");
+   }
+
+   ::close(fd);
+}
+
+/**
+ * Appends a row of doubles.  The row is written to the file when
+ * rows_per_chunk rows have been collected.
+ *
+ * @param row vector of doubles
+ */
+void Columnar_writer::append(const Eigen::ArrayXd& row)
+{
+   if (static_cast<std::size_t>(row.size()) != number_of_columns) {
+      ERROR("Columnar_writer: number of columns (" << number_of_columns <<
+            ") does not match row size (" << row.size() << ")!");
+      return;
+   }
+
+   buffer.row(number_of_rows++) = row.transpose();
+
+   if (number_of_rows == rows_per_chunk) {
+      flush();
+   }
+}
+
+/**
+ * Writes the buffered rows as one chunk to the end of the file.  If
+ * writing fails, the rows are kept in the buffer and the incomplete
+ * chunk is removed by the next call.
+ */
+void Columnar_writer::flush()
+{
+   if (number_of_rows == 0) {
+      return;
+   }
+
+   File_lock lock(fd);
+
+   remove_incomplete_chunk();
+
+   const std::uint64_t begin = end_of_data;
+   const std::uint64_t rows = number_of_rows;
+
+   try {
+      write(&rows, sizeof(rows));
+      for (std::size_t c = 0; c < number_of_columns; c++) {
+         write(buffer.col(c).data(), number_of_rows * sizeof(double));
+      }
+   } catch (...) {
+      end_of_data = begin;
+      throw;
+   }
+
+   number_of_rows = 0;
+}
+
+/**
+ * Skips the complete chunks after the last known chunk, which may
+ * have been appended by other writers, and truncates the file after
+ * the last complete chunk.  Must be called while the file is locked.
+ */
+void Columnar_writer::remove_incomplete_chunk()
+{
+   const std::uint64_t size = file_size(fd);
+   const std::uint64_t row_size = number_of_columns * sizeof(double);
+   std::uint64_t rows = 0;
+
+   while (end_of_data + sizeof(rows) <= size &&
+          pread(fd, &rows, sizeof(rows), end_of_data) == sizeof(rows)) {
+      const std::uint64_t available = size - end_of_data - sizeof(rows);
+      if (row_size > 0 && rows > available / row_size) {
+         break;
+      }
+      end_of_data += sizeof(rows) + rows * row_size;
+   }
+
+   if (end_of_data < size) {
+      WARNING("Columnar_writer: removing incomplete chunk at the end of " << file_name);
+      if (ftruncate(fd, end_of_data) != 0) {
+         throw SetupError("Columnar_writer: cannot truncate " + file_name);
+      }
+   }
+}
+
+/**
+ * Writes the given bytes to the end of the last complete chunk.
+ */
+void Columnar_writer::write(const void* data, std::size_t n)
+{
+   const char* p = static_cast<const char*>(data);
+
+   while (n > 0) {
+      const ssize_t written = pwrite(fd, p, n, end_of_data);
+      if (written < 0) {
+         if (errno == EINTR) {
+            continue;
+         }
+         throw SetupError("Columnar_writer: writing to " + file_name + " failed");
+      }
+      p += written;
+      n -= written;
+      end_of_data += written;
+   }
+}
+
+/**
+ * Reads the header and the chunk positions of the given file.
+ *
+ * @param file_name file name
+ */
+Columnar_reader::Columnar_reader(const std::string& file_name)
+   : file(file_name, std::ios::binary)
+{
+   if (!file || !read_header(file, names)) {
+      throw ReadError("Columnar_reader: cannot read header of " + file_name);
+   }
+
+   const std::streamoff begin = file.tellg();
+   file.seekg(0, std::ios::end);
+   const std::streamoff end = file.tellg();
+   file.seekg(begin);
+
+   std::uint64_t rows = 0;
+
+   while (read_uint64(file, rows)) {
+      const Chunk chunk{number_of_rows, static_cast<std::size_t>(rows), file.tellg()};
+      const std::streamoff next = chunk.offset + rows * names.size() * sizeof(double);
+      if (next > end) {
+         WARNING("Columnar_reader: ignoring incomplete chunk at the end of " << file_name);
+         break;
+      }
+      chunks.push_back(chunk);
+      number_of_rows += rows;
+      file.seekg(next);
+   }
+
+   file.clear();
+}
+
+/**
+ * @param col column index
+ * @return values of the column in all rows
+ */
+Eigen::ArrayXd Columnar_reader::get_column(std::size_t col) const
+{
+   if (col >= names.size()) {
+      throw OutOfBoundsError("Columnar_reader: column index " +
+                             std::to_string(col) + " out of range");
+   }
+
+   Eigen::ArrayXd values(number_of_rows);
+
+   for (const auto& chunk: chunks) {
+      read(chunk.offset + col * chunk.rows * sizeof(double),
+           values.data() + chunk.first_row, chunk.rows);
+   }
+
+   return values;
+}
+
+/**
+ * @param name column name
+ * @return values of the column in all rows
+ */
+Eigen::ArrayXd Columnar_reader::get_column(const std::string& name) const
+{
+   const auto it = std::find(names.cbegin(), names.cend(), name);
+
+   if (it == names.cend()) {
+      throw OutOfBoundsError("Columnar_reader: no column named " + name);
+   }
+
+   return get_column(std::distance(names.cbegin(), it));
+}
+
+/**
+ * @param row row index
+ * @return values of all columns in the row
+ */
+Eigen::ArrayXd Columnar_reader::get_row(std::size_t row) const
+{
+   if (row >= number_of_rows) {
+      throw OutOfBoundsError("Columnar_reader: row index " +
+                             std::to_string(row) + " out of range");
+   }
+
+   const auto chunk = std::upper_bound(
+      chunks.cbegin(), chunks.cend(), row,
+      [] (std::size_t r, const Chunk& c) { return r < c.first_row; }) - 1;
+
+   Eigen::ArrayXd values(names.size());
+
+   for (std::size_t c = 0; c < names.size(); c++) {
+      read(chunk->offset + (c * chunk->rows + row - chunk->first_row) * sizeof(double),
+           values.data() + c, 1);
+   }
+
+   return values;
+}
+
+void Columnar_reader::read(std::streamoff pos, double* dest, std::size_t n) const
+{
+   if (!file.seekg(pos) ||
+       !file.read(reinterpret_cast<char*>(dest), n * sizeof(double))) {
+      file.clear();
+      throw ReadError("Columnar_reader: cannot read values from file");
+   }
+}
+
+} // namespace columnar
+} // namespace flexiblesusy
@@ -0,0 +1,132 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef COLUMNAR_IO_H
+#define COLUMNAR_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace flexiblesusy {
+namespace columnar {
+
+/**
+ * @class Columnar_writer
+ * @brief appends rows of doubles to a columnar binary file
+ *
+ * The file consists of a header, which contains the column names,
+ * followed by chunks of rows.  Within each chunk the values are
+ * stored column by column as native doubles, aligned to 8 bytes, s.t.
+ * the file can be memory-mapped:
+ *
+ * @code
+ * header: "FSCOLUMN" | uint64 version | uint64 number of columns
+ *         | for each column: uint64 length | name (padded to 8 bytes)
+ * chunk:  uint64 number of rows n | n values of column 1 | ...
+ *         | n values of the last column
+ * @endcode
+ *
+ * If the file already exists, the column names must match the names
+ * in the header and the new rows are appended.  The rows are
+ * buffered and written in chunks of rows_per_chunk rows.  The
+ * remaining rows are written by flush() or by the destructor.  The
+ * file is kept open during the lifetime of the writer.
+ *
+ * The file is locked while the header is checked and while a chunk
+ * is written, s.t. several writers (also from different processes)
+ * can append to the same file.  An incomplete chunk at the end of the
+ * file, which is left by an aborted writer, is removed before new
+ * rows are appended.
+ */
+class Columnar_writer {
+public:
+   Columnar_writer(const std::string&, const std::vector<std::string>&,
+                   std::size_t rows_per_chunk = 1024);
+   Columnar_writer(const Columnar_writer&) = delete;
+   Columnar_writer(Columnar_writer&&) = delete;
+   Columnar_writer& operator=(const Columnar_writer&) = delete;
+   Columnar_writer& operator=(Columnar_writer&&) = delete;
+   ~Columnar_writer();
+
+   /// append a row of doubles
+   void append(const Eigen::ArrayXd&);
+   /// write buffered rows to the file
+   void flush();
+
+private:
+   std::string file_name{};        ///< output file name
+   int fd{-1};                     ///< file descriptor of output file
+   std::uint64_t end_of_data{0};   ///< end of the last complete chunk
+   std::size_t number_of_columns{0}; ///< number of columns
+   std::size_t rows_per_chunk{1024}; ///< number of rows per chunk
+   std::size_t number_of_rows{0};  ///< number of buffered rows
+   Eigen::ArrayXXd buffer{};       ///< buffered rows (column-major)
+
+   void remove_incomplete_chunk();
+   void write(const void*, std::size_t);
+};
+
+/**
+ * @class Columnar_reader
+ * @brief reads a columnar binary file written by Columnar_writer
+ *
+ * The constructor reads the header and the positions of the chunks.
+ * The values are read from the file only when a column or a row is
+ * requested, s.t. single columns can be extracted from large files
+ * without reading the whole file.
+ */
+class Columnar_reader {
+public:
+   explicit Columnar_reader(const std::string&);
+
+   const std::vector<std::string>& get_names() const { return names; }
+   std::size_t get_number_of_columns() const { return names.size(); }
+   std::size_t get_number_of_rows() const { return number_of_rows; }
+
+   /// returns column with given index
+   Eigen::ArrayXd get_column(std::size_t) const;
+   /// returns column with given name
+   Eigen::ArrayXd get_column(const std::string&) const;
+   /// returns row with given index
+   Eigen::ArrayXd get_row(std::size_t) const;
+
+private:
+   /// position and size of a chunk
+   struct Chunk {
+      std::size_t first_row;   ///< index of first row in chunk
+      std::size_t rows;        ///< number of rows in chunk
+      std::streamoff offset;   ///< file position of first value in chunk
+   };
+
+   mutable std::ifstream file{};     ///< input file
+   std::vector<std::string> names{}; ///< column names
+   std::vector<Chunk> chunks{};      ///< chunks
+   std::size_t number_of_rows{0};    ///< total number of rows
+
+   void read(std::streamoff, double*, std::size_t) const;
+};
+
+} // namespace columnar
+} // namespace flexiblesusy
+
+#endif
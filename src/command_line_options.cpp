@@ -61,6 +61,8 @@ void Command_line_options::parse(const Dynamic_array_view<char*>& args)
          spectrum_file = option.substr(23);
       } else if (starts_with(option,"--database-output-file=")) {
          database_output_file = option.substr(23);
+      } else if (starts_with(option,"--columnar-output-file=")) {
+         columnar_output_file = option.substr(23);
       } else if (starts_with(option,"--rgflow-output-file=")) {
          rgflow_file = option.substr(21);
       } else if (option == "--help" || option == "-h") {
@@ -111,6 +113,8 @@ void Command_line_options::print_usage(std::ostream& ostr) const
            "  --spectrum-output-file=<filename> file to write spectrum to\n"
            "  --database-output-file=<filename> SQLite database file to write\n"
            "                                    parameter point to\n"
+           "  --columnar-output-file=<filename> columnar binary file to append\n"
+           "                                    parameter point to\n"
            "  --rgflow-output-file=<filename>   file to write rgflow to\n"
            "  --build-info                      print build information\n"
            "  --model-info                      print model information\n"
@@ -0,0 +1,293 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef CONTINUATION_H
+#define CONTINUATION_H
+
+#include "logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <Eigen/Core>
+
+/**
+ * @file continuation.hpp
+ * @brief contains the continuation driver for parameter scans
+ */
+
+namespace flexiblesusy {
+
+/**
+ * @class Continuation
+ * @brief Continuation (homotopy) driver for scans along a parameter path
+ *
+ * Solves a sequence of boundary value problems along a path of
+ * parameter points.  Each point is started from a prediction of its
+ * solution, which is extrapolated linearly in the arc length of the
+ * path from the last two converged points (secant predictor).
+ *
+ * Between two requested points the path is walked with an adaptive
+ * step size: After each converged step the step size is scaled by
+ * the ratio of the target number of iterations and the iterations
+ * needed, limited to the interval [1/2, 2].  If the solver does not
+ * converge, the step is bisected.
+ * If the step becomes smaller than the distance between the
+ * requested points divided by 2^max_bisections, the requested point
+ * is solved from the default initial guess (empty prediction) and
+ * the continuation is re-started from there.
+ *
+ * The point solver gets the parameter point and the predicted
+ * solution (empty if no prediction is available) and returns a
+ * Continuation::Point, which contains the converged solution (empty
+ * if the solver did not converge), the number of iterations and a
+ * user-defined result.  Only the results of the requested points are
+ * returned by run().
+ *
+ * Example:
+ * @code
+ * Continuation<double> continuation(
+ *    [] (const Eigen::VectorXd& p, const Eigen::ArrayXd& guess) {
+ *       Continuation<double>::Point point;
+ *       // solve for parameter point p, starting from guess
+ *       return point;
+ *    });
+ * const auto points = continuation.run(float_range(0., 100., 10));
+ * @endcode
+ */
+template <class Result>
+class Continuation {
+public:
+   /// solution of a single parameter point
+   struct Point {
+      Result result{};           ///< user-defined result
+      Eigen::ArrayXd solution{}; ///< converged solution (empty if not converged)
+      int iterations{0};         ///< number of iterations
+   };
+   using Point_solver_t = std::function<Point(const Eigen::VectorXd&, const Eigen::ArrayXd&)>;
+
+   Continuation() = default;
+   template <typename F>
+   explicit Continuation(F&& solver_) : solver(std::forward<F>(solver_)) {}
+
+   template <typename F>
+   void set_point_solver(F&& f) { solver = std::forward<F>(f); }
+   /// set number of iterations per step the step size is adapted to
+   void set_target_iterations(int n) { target_iterations = n; }
+   /// set maximum number of bisections between two requested points
+   void set_max_bisections(int n) { max_bisections = n; }
+
+   std::vector<Point> run(const std::vector<Eigen::VectorXd>&);
+   std::vector<Point> run(const std::vector<double>&);
+
+   /// number of calls of the point solver in the last run
+   std::size_t get_number_of_solves() const { return number_of_solves; }
+   /// total number of iterations in the last run
+   long get_number_of_iterations() const { return number_of_iterations; }
+   /// number of requested points without converged solution in the last run
+   std::size_t get_number_of_failures() const { return number_of_failures; }
+
+private:
+   /// converged point at arc length s
+   struct Node {
+      double s;
+      Eigen::ArrayXd solution;
+   };
+
+   Point_solver_t solver{nullptr}; ///< point solver
+   int target_iterations{5};       ///< desired iterations per step
+   int max_bisections{3};          ///< maximum number of bisections
+   std::vector<Node> history{};    ///< last (up to) two converged points
+   double step{0.};                ///< current step size
+   std::size_t number_of_solves{0};
+   long number_of_iterations{0};
+   std::size_t number_of_failures{0};
+
+   Point solve(const Eigen::VectorXd&, const Eigen::ArrayXd&);
+   Point walk(const Eigen::VectorXd&, const Eigen::VectorXd&, double, double);
+   Eigen::ArrayXd predict(double) const;
+   void add_to_history(double, const Eigen::ArrayXd&);
+};
+
+/**
+ * Solves all points of the given path and returns their results in
+ * the same order.  Consecutive points of the path should be
+ * neighbours in parameter space.
+ *
+ * @param path parameter points
+ *
+ * @return results of the points
+ */
+template <class Result>
+auto Continuation<Result>::run(const std::vector<Eigen::VectorXd>& path)
+   -> std::vector<Point>
+{
+   history.clear();
+   step = std::numeric_limits<double>::infinity();
+   number_of_solves = 0;
+   number_of_iterations = 0;
+   number_of_failures = 0;
+
+   std::vector<Point> results;
+   results.reserve(path.size());
+   double s = 0.; // arc length of the current point
+
+   for (std::size_t k = 0; k < path.size(); k++) {
+      const double distance = k > 0 ? (path[k] - path[k-1]).norm() : 0.;
+
+      if (history.empty() || distance == 0.) {
+         results.push_back(solve(path[k], predict(s + distance)));
+         if (results.back().solution.size() > 0)
+            add_to_history(s + distance, results.back().solution);
+      } else {
+         results.push_back(walk(path[k-1], path[k], s, distance));
+      }
+
+      if (results.back().solution.size() == 0) {
+         number_of_failures++;
+         history.clear();
+      }
+
+      s += distance;
+   }
+
+   return results;
+}
+
+/**
+ * Solves all points of a 1-dimensional scan.
+ *
+ * @param points parameter values
+ *
+ * @return results of the points
+ */
+template <class Result>
+auto Continuation<Result>::run(const std::vector<double>& points)
+   -> std::vector<Point>
+{
+   std::vector<Eigen::VectorXd> path(points.size(), Eigen::VectorXd(1));
+
+   for (std::size_t i = 0; i < points.size(); i++)
+      path[i](0) = points[i];
+
+   return run(path);
+}
+
+/**
+ * Walks from the converged point a to the requested point b with
+ * adaptive step size and returns the result of b.
+ *
+ * @param a start point (converged)
+ * @param b requested point
+ * @param s0 arc length of a
+ * @param distance distance between a and b
+ *
+ * @return result of b
+ */
+template <class Result>
+auto Continuation<Result>::walk(
+   const Eigen::VectorXd& a, const Eigen::VectorXd& b, double s0, double distance)
+   -> Point
+{
+   const double min_step = std::ldexp(distance, -max_bisections);
+   double pos = 0.; // distance walked from a
+
+   for (;;) {
+      // avoid a tiny last step due to rounding
+      const bool last = pos + step >= (1. - 1e-8) * distance;
+      const double next = last ? distance : pos + step;
+      const Eigen::VectorXd p = last ? b : Eigen::VectorXd(a + (next/distance)*(b - a));
+      Point point = solve(p, predict(s0 + next));
+
+      if (point.solution.size() > 0) {
+         add_to_history(s0 + next, point.solution);
+         const double ratio = static_cast<double>(target_iterations)
+            / std::max(point.iterations, 1);
+         step = std::min(2., std::max(0.5, ratio)) * (next - pos);
+         pos = next;
+         if (last)
+            return point;
+      } else {
+         step = 0.5 * (next - pos);
+         VERBOSE_MSG("Continuation: no convergence, reducing step size to " << step);
+         if (step < min_step) {
+            VERBOSE_MSG("Continuation: minimum step size reached,"
+                        " solving point from default initial guess");
+            history.clear();
+            step = std::numeric_limits<double>::infinity();
+            point = solve(b, Eigen::ArrayXd());
+            if (point.solution.size() > 0)
+               add_to_history(s0 + distance, point.solution);
+            return point;
+         }
+      }
+   }
+}
+
+template <class Result>
+auto Continuation<Result>::solve(
+   const Eigen::VectorXd& p, const Eigen::ArrayXd& guess) -> Point
+{
+   Point point = solver(p, guess);
+   number_of_solves++;
+   number_of_iterations += point.iterations;
+   return point;
+}
+
+/**
+ * Predicts the solution at arc length s by linear extrapolation of
+ * the last two converged points.
+ *
+ * @param s arc length
+ *
+ * @return predicted solution (empty if there is no converged point)
+ */
+template <class Result>
+Eigen::ArrayXd Continuation<Result>::predict(double s) const
+{
+   if (history.empty())
+      return Eigen::ArrayXd();
+
+   const Node& n1 = history.back();
+
+   if (history.size() < 2)
+      return n1.solution;
+
+   const Node& n0 = history.front();
+
+   if (n0.solution.size() != n1.solution.size() || n0.s == n1.s)
+      return n1.solution;
+
+   return n1.solution + ((s - n1.s)/(n1.s - n0.s))*(n1.solution - n0.solution);
+}
+
+template <class Result>
+void Continuation<Result>::add_to_history(double s, const Eigen::ArrayXd& solution)
+{
+   if (history.size() > 1)
+      history.erase(history.begin());
+   history.push_back(Node{s, solution});
+}
+
+} // namespace flexiblesusy
+
+#endif
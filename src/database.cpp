@@ -17,6 +17,7 @@
 // ====================================================================
 
 #include "database.hpp"
+#include "raii.hpp"
 #include "logger.hpp"
 #include "config.h"
 
@@ -35,10 +36,12 @@ namespace database {
 Database::Database(const std::string& file_name)
    : db(open(file_name))
 {
+   execute("PRAGMA synchronous = OFF;");
 }
 
 Database::~Database()
 {
+   sqlite3_finalize(insert_stmt);
    sqlite3_close(db);
 }
 
@@ -54,36 +57,64 @@ void Database::insert(
    const std::string& table_name, const std::vector<std::string>& names,
    const Eigen::ArrayXd& data)
 {
-   const std::size_t number_of_elements = data.rows();
+   insert(table_name, names, std::vector<Eigen::ArrayXd>{data});
+}
 
-   if (names.size() != number_of_elements) {
-      ERROR("number of column names (" << names.size() <<
-            ") does not match vector size (" << number_of_elements << ")!");
-      return;
+/**
+ * Insert several rows of doubles into a table within one transaction.
+ * If the table does not exist, it is created.  The INSERT statement
+ * is prepared once and re-used for subsequent insertions into the
+ * same table.  If one of the rows cannot be inserted, the transaction
+ * is rolled back, i.e. none of the rows is inserted.
+ *
+ * @param table_name name of table
+ * @param names vector of column names
+ * @param rows vector of rows
+ */
+void Database::insert(
+   const std::string& table_name, const std::vector<std::string>& names,
+   const std::vector<Eigen::ArrayXd>& rows)
+{
+   for (const auto& data: rows) {
+      const std::size_t number_of_elements = data.rows();
+
+      if (names.size() != number_of_elements) {
+         ERROR("number of column names (" << names.size() <<
+               ") does not match vector size (" << number_of_elements << ")!");
+         return;
+      }
    }
 
-   create_table<double>(table_name, names);
+   if (rows.empty()) {
+      return;
+   }
 
-   std::string sql("INSERT INTO " + table_name + " (");
+   sqlite3_stmt* stmt = prepare_insert(table_name, names);
 
-   for (std::size_t i = 0; i < number_of_elements; i++) {
-      sql += '"' + names[i] + '"';
-      if (i + 1 != number_of_elements)
-         sql += ',';
+   if (!stmt) {
+      return;
    }
 
-   sql += ") VALUES (";
+   execute("BEGIN TRANSACTION;");
 
-   for (std::size_t i = 0; i < number_of_elements; i++) {
-      sql += boost::lexical_cast<std::string>(data[i]);
-      if (i + 1 != number_of_elements)
-         sql += ',';
-   }
+   for (const auto& data: rows) {
+      for (int i = 0; i < data.rows(); i++) {
+         sqlite3_bind_double(stmt, i + 1, data[i]);
+      }
 
-   sql += ");";
+      if (sqlite3_step(stmt) != SQLITE_DONE) {
+         ERROR("SQL error while inserting into table " << table_name
+               << ": " << sqlite3_errmsg(db) << ", none of the "
+               << rows.size() << " rows of the transaction is inserted");
+         sqlite3_reset(stmt);
+         execute("ROLLBACK;");
+         return;
+      }
 
-   execute("PRAGMA synchronous = OFF;");
-   execute(sql);
+      sqlite3_reset(stmt);
+   }
+
+   execute("COMMIT;");
 }
 
 /**
@@ -133,6 +164,63 @@ void Database::create_table(
    execute(sql);
 }
 
+/**
+ * Returns the prepared INSERT statement for the given table and
+ * columns.  If the statement has not been prepared before, the table
+ * is created (if it does not exist) and the statement is prepared.
+ *
+ * @param table_name name of table
+ * @param names names of table columns
+ *
+ * @return prepared statement, or nullptr if the statement cannot be prepared
+ */
+sqlite3_stmt* Database::prepare_insert(
+   const std::string& table_name, const std::vector<std::string>& names)
+{
+   const std::size_t number_of_elements = names.size();
+   std::string sql("INSERT INTO " + table_name + " (");
+
+   for (std::size_t i = 0; i < number_of_elements; i++) {
+      sql += '"' + names[i] + '"';
+      if (i + 1 != number_of_elements)
+         sql += ',';
+   }
+
+   sql += ") VALUES (";
+
+   for (std::size_t i = 0; i < number_of_elements; i++) {
+      sql += '?';
+      if (i + 1 != number_of_elements)
+         sql += ',';
+   }
+
+   sql += ");";
+
+   if (insert_stmt && sql == insert_sql) {
+      return insert_stmt;
+   }
+
+   create_table<double>(table_name, names);
+
+   sqlite3_finalize(insert_stmt);
+   insert_stmt = nullptr;
+   insert_sql.clear();
+
+   const int rc = sqlite3_prepare_v2(db, sql.c_str(), -1, &insert_stmt, nullptr);
+
+   if (rc != SQLITE_OK) {
+      ERROR("SQL error while preparing command \"" << sql << "\": "
+            << sqlite3_errmsg(db));
+      sqlite3_finalize(insert_stmt);
+      insert_stmt = nullptr;
+      return nullptr;
+   }
+
+   insert_sql = sql;
+
+   return insert_stmt;
+}
+
 /**
  * Execute a SQL command without a callback.
  *
@@ -209,8 +297,10 @@ int Database::extract_callback(void* data, int argc, char** argv, char** col_nam
    values->conservativeResize(argc);
 
    for (int i = 0; i < argc; i++) {
-      (*values)(i) = boost::lexical_cast<double>(argv[i]);
-      VERBOSE_MSG(col_name[i] << " = " << argv[i]);
+      // NaN is stored as NULL
+      (*values)(i) = argv[i] ? boost::lexical_cast<double>(argv[i])
+                             : std::numeric_limits<double>::quiet_NaN();
+      VERBOSE_MSG(col_name[i] << " = " << (argv[i] ? argv[i] : "NULL"));
    }
 
    return 0;
@@ -239,6 +329,12 @@ void Database::insert(
    throw DisabledSQLiteError("Cannot call insert(), because SQLite support is disabled.");
 }
 
+void Database::insert(
+   const std::string&, const std::vector<std::string>&, const std::vector<Eigen::ArrayXd>&)
+{
+   throw DisabledSQLiteError("Cannot call insert(), because SQLite support is disabled.");
+}
+
 Eigen::ArrayXd Database::extract(const std::string&, long long)
 {
    throw DisabledSQLiteError("Cannot call extract(), because SQLite support is disabled.");
@@ -249,6 +345,11 @@ void Database::create_table(const std::string&, const std::vector<std::string>&)
 {
 }
 
+sqlite3_stmt* Database::prepare_insert(const std::string&, const std::vector<std::string>&)
+{
+   return nullptr;
+}
+
 void Database::execute(const std::string&) {}
 
 void Database::execute(const std::string&, TCallback, void*) {}
@@ -267,3 +368,103 @@ int Database::extract_callback(void*, int, char**, char**)
 } // namespace flexiblesusy
 
 #endif
+
+namespace flexiblesusy {
+namespace database {
+
+/**
+ * @param file_name database file name
+ * @param table_name_ name of table
+ * @param names_ column names
+ * @param rows_per_transaction_ number of rows written per transaction
+ */
+Database_writer::Database_writer(
+   const std::string& file_name, const std::string& table_name_,
+   const std::vector<std::string>& names_, std::size_t rows_per_transaction_)
+   : db(file_name)
+   , table_name(table_name_)
+   , names(names_)
+   , rows_per_transaction(rows_per_transaction_ > 0 ? rows_per_transaction_ : 1)
+{
+   queue.reserve(rows_per_transaction);
+}
+
+Database_writer::~Database_writer()
+{
+   try {
+      flush();
+   } catch (...) {
+      ERROR("Database_writer: writing the remaining rows to table "
+            << table_name << " failed");
+   }
+}
+
+/**
+ * Adds a row of doubles to the queue.  If the queue contains
+ * rows_per_transaction rows, the rows are written to the table.  This
+ * function is thread-safe.
+ *
+ * @param data vector of doubles
+ */
+void Database_writer::insert(const Eigen::ArrayXd& data)
+{
+   std::vector<Eigen::ArrayXd> rows;
+   std::size_t batch = 0;
+
+   {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      queue.push_back(data);
+      if (queue.size() < rows_per_transaction) {
+         return;
+      }
+      rows.swap(queue);
+      queue.reserve(rows_per_transaction);
+      batch = number_of_batches++;
+   }
+
+   write(rows, batch);
+}
+
+/**
+ * Writes all queued rows to the table.  This function is
+ * thread-safe.
+ */
+void Database_writer::flush()
+{
+   std::vector<Eigen::ArrayXd> rows;
+   std::size_t batch = 0;
+
+   {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      rows.swap(queue);
+      batch = number_of_batches++;
+   }
+
+   write(rows, batch);
+}
+
+/**
+ * Writes the given rows to the table, after all batches which were
+ * handed off before have been written.
+ *
+ * @param rows rows to be written
+ * @param batch number of the batch in the order of the hand-off
+ */
+void Database_writer::write(const std::vector<Eigen::ArrayXd>& rows, std::size_t batch)
+{
+   std::unique_lock<std::mutex> lock(db_mutex);
+   batch_written.wait(lock, [this, batch] { return number_of_written_batches == batch; });
+
+   // let the next batch proceed, even if the insertion throws
+   const auto next_batch = make_raii_guard([this] {
+      ++number_of_written_batches;
+      batch_written.notify_all();
+   });
+
+   if (!rows.empty()) {
+      db.insert(table_name, names, rows);
+   }
+}
+
+} // namespace database
+} // namespace flexiblesusy
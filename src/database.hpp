@@ -17,12 +17,15 @@
 // ====================================================================
 
 #include "error.hpp"
+#include <condition_variable>
 #include <cstddef>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <Eigen/Core>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace flexiblesusy {
 namespace database {
@@ -36,6 +39,8 @@ public:
 
    /// insert a row of doubles into a table
    void insert(const std::string&, const std::vector<std::string>&, const Eigen::ArrayXd&);
+   /// insert several rows of doubles into a table in one transaction
+   void insert(const std::string&, const std::vector<std::string>&, const std::vector<Eigen::ArrayXd>&);
 
    /// extract a row of doubles from a table
    Eigen::ArrayXd extract(const std::string&, long long);
@@ -62,14 +67,77 @@ private:
    };
 
    sqlite3* db; ///< pointer to database object
+   sqlite3_stmt* insert_stmt{nullptr}; ///< prepared INSERT statement
+   std::string insert_sql{};           ///< SQL of prepared INSERT statement
 
    sqlite3* open(const std::string&);
    void execute(const std::string&);
    void execute(const std::string&, TCallback, void*);
    template <typename T> void create_table(const std::string&, const std::vector<std::string>&);
+   sqlite3_stmt* prepare_insert(const std::string&, const std::vector<std::string>&);
 
    static int extract_callback(void*, int, char**, char**);
 };
 
+/**
+ * @class Database_writer
+ * @brief buffered insertion of rows into a database table
+ *
+ * The rows passed to insert() are collected in a queue and written
+ * to the table in transactions of rows_per_transaction rows, using a
+ * prepared INSERT statement.  insert() may be called from several
+ * threads at the same time.  The remaining rows are written by
+ * flush() or by the destructor.
+ *
+ * The rows are written in the order of the insert() calls: each full
+ * queue is numbered when it is handed off, and the batches are
+ * written one after another in this order.  The queue is not locked
+ * while a batch is written, so other threads can continue to insert
+ * rows.  If a row of a batch cannot be written, none of the rows of
+ * this batch is written and an error is logged.
+ *
+ * If rows are inserted from several threads, the order of the
+ * insert() calls, and therefore of the rows, is not deterministic.
+ * If the rows must be associated with their input, an identifying
+ * column (e.g. the index of the scan point) should be
+ * part of each row.
+ *
+ * Example:
+ * @code
+ * Database_writer writer("scan.db", "Point", names, 100);
+ *
+ * // in each scan thread
+ * writer.insert(values);
+ * @endcode
+ */
+class Database_writer {
+public:
+   Database_writer(const std::string&, const std::string&,
+                   const std::vector<std::string>&,
+                   std::size_t rows_per_transaction = 100);
+   Database_writer(const Database_writer&) = delete;
+   Database_writer(Database_writer&&) = delete;
+   ~Database_writer();
+
+   /// add a row of doubles to the queue
+   void insert(const Eigen::ArrayXd&);
+   /// write all queued rows to the table
+   void flush();
+
+private:
+   Database db;                     ///< database
+   std::string table_name;          ///< name of table
+   std::vector<std::string> names;  ///< column names
+   std::size_t rows_per_transaction{100}; ///< number of rows per transaction
+   std::vector<Eigen::ArrayXd> queue{};   ///< rows to be written
+   std::size_t number_of_batches{0}; ///< number of batches handed off
+   std::mutex queue_mutex{};        ///< protects the queue and number_of_batches
+   std::size_t number_of_written_batches{0}; ///< number of batches written
+   std::mutex db_mutex{};           ///< serializes the database access
+   std::condition_variable batch_written{}; ///< signals a written batch
+
+   void write(const std::vector<Eigen::ArrayXd>&, std::size_t);
+};
+
 } // namespace database
 } // namespace flexiblesusy
@@ -149,7 +149,7 @@ int Lattice_RKRGE::evolve_to(Real to, Adapter& a, Real eps)
 		}
 
 		return dxD;
-	    }, odeStepper);
+	    });
 
        a.x(0) = to;
     } catch(Error&) {
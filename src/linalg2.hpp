@@ -19,6 +19,7 @@
 #ifndef linalg2_hpp
 #define linalg2_hpp
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <cctype>
@@ -1616,6 +1617,229 @@ void fs_diagonalize_hermitian
     fs_diagonalize_hermitian_errbd(m, w, 0, &w_errbd);
 }
 
+/**
+ * Diagonalizes N-by-N hermitian matrix m with cyclic Jacobi
+ * rotations so that
+ *
+ *     m == z.adjoint() * w.matrix().asDiagonal() * z    // convention of SARAH
+ *
+ * The Jacobi sweeps start from z0 * m * z0.adjoint(), where z0 is a
+ * unitary matrix.  If z0 is the rotation of a nearby matrix, only a
+ * few sweeps are necessary.  w is arranged so that `abs(w[i])` are
+ * in ascending order.
+ *
+ * If z is a null pointer, the rotations are not accumulated and the
+ * sweeps stop as soon as the eigenvalues have converged, which
+ * happens earlier than for the eigenvectors, because the error of
+ * the eigenvalues is quadratic in the off-diagonal elements.
+ *
+ * @tparam     Real    type of real and imaginary parts of Scalar
+ * @tparam     Scalar  type of elements of m and z
+ * @tparam     N       number of rows and columns in m and z
+ * @param[in]  m       N-by-N matrix to be diagonalized
+ * @param[out] w       array of length N to contain eigenvalues
+ * @param[in]  z0      N-by-N unitary matrix to start from
+ * @param[out] z       N-by-N unitary matrix
+ * @param[out] w_errbd approximate error bound for the elements of w
+ *
+ * @return true if the sweeps have converged, false otherwise (w and
+ * z are undefined in this case)
+ */
+template<class Real, class Scalar, int N>
+bool diagonalize_hermitian_jacobi
+(const Eigen::Matrix<Scalar, N, N>& m,
+ Eigen::Array<Real, N, 1>& w,
+ const Eigen::Matrix<Scalar, N, N>& z0,
+ Eigen::Matrix<Scalar, N, N> *z = 0,
+ Real *w_errbd = 0)
+{
+    using Eigen::numext::abs2;
+    using Eigen::numext::conj;
+    const int max_sweeps = 50;
+    const Real EPSMCH = std::numeric_limits<Real>::epsilon();
+
+    Eigen::Matrix<Scalar, N, N> v(z0.adjoint());
+    Eigen::Matrix<Scalar, N, N> a(z0 * m * v);
+    a = (Real(0.5) * (a + a.adjoint())).eval();
+
+    const Real tol = EPSMCH * a.norm();
+    Real errbd = 0;
+    bool converged = false;
+
+    for (int sweep = 0; sweep <= max_sweeps && !converged; sweep++) {
+	Eigen::Array<Real, N, 1> off_row;
+	for (int p = 0; p < N; p++) {
+	    off_row(p) = 0;
+	    for (int q = 0; q < N; q++)
+		if (q != p) off_row(p) += abs2(a(p,q));
+	}
+	const Real off = std::sqrt(off_row.sum());
+
+	if (off <= tol) {
+	    errbd = tol + off;
+	    converged = true;
+	} else if (!z) {
+	    // residual bound |w_p - a(p,p)| <= off_row(p)/gap(p)
+	    errbd = 0;
+	    converged = true;
+	    for (int p = 0; p < N && converged; p++) {
+		Real gap = std::numeric_limits<Real>::max();
+		for (int q = 0; q < N; q++)
+		    if (q != p)
+			gap = std::min(gap, std::abs(std::real(a(p,p) - a(q,q))));
+		gap -= 2 * off;
+		if (gap <= 0 || off_row(p) > tol * gap)
+		    converged = false;
+		else
+		    errbd = std::max(errbd, off_row(p) / gap);
+	    }
+	    errbd += tol;
+	}
+
+	if (converged || sweep == max_sweeps)
+	    break;
+
+	for (int p = 0; p < N; p++) {
+	    for (int q = p + 1; q < N; q++) {
+		const Real apq = std::sqrt(abs2(a(p,q)));
+		if (apq <= tol / N)
+		    continue;
+		// rotation J = [[c, s], [-conj(s), c]] in the (p,q) plane
+		const Real theta = std::real(a(q,q) - a(p,p)) / (2 * apq);
+		const Real t = (theta >= 0 ? 1 : -1) /
+		    (std::abs(theta) + std::sqrt(theta * theta + 1));
+		const Real c = 1 / std::sqrt(t * t + 1);
+		const Scalar s = (t * c / apq) * a(p,q);
+		const Real app = std::real(a(p,p)), aqq = std::real(a(q,q));
+		const Eigen::Matrix<Scalar, N, 1> ap(a.col(p));
+		a.col(p) = c * ap - conj(s) * a.col(q);
+		a.col(q) = s * ap + c * a.col(q);
+		a.row(p) = a.col(p).adjoint();
+		a.row(q) = a.col(q).adjoint();
+		a(p,p) = app - t * apq;
+		a(q,q) = aqq + t * apq;
+		a(p,q) = a(q,p) = Scalar(0);
+		if (z) {
+		    const Eigen::Matrix<Scalar, N, 1> vp(v.col(p));
+		    v.col(p) = c * vp - conj(s) * v.col(q);
+		    v.col(q) = s * vp + c * v.col(q);
+		}
+	    }
+	}
+    }
+
+    if (!converged)
+	return false;
+
+    w = a.diagonal().real();
+    if (w_errbd) *w_errbd = errbd;
+
+    Eigen::PermutationMatrix<N> p;
+    p.setIdentity();
+    std::sort(p.indices().data(), p.indices().data() + p.indices().size(),
+              [&w] (int i, int j) { return std::abs(w[i]) < std::abs(w[j]); });
+    w.matrix().transpose() *= p;
+    if (z) *z = (v * p).adjoint().eval();
+
+    return true;
+}
+
+template<class Real, class Scalar, int N>
+void fs_diagonalize_hermitian_batch_errbd
+(const std::array<Eigen::Matrix<Scalar, N, N>, std::size_t(N)>& m,
+ Eigen::Array<Real, N, 1>& w,
+ Eigen::Matrix<Scalar, N, N>& z,
+ int idx,
+ Real *w_errbd = 0)
+{
+    const Real EPSMCH = std::numeric_limits<Real>::epsilon();
+    const Eigen::Matrix<Scalar, N, N> unity(Eigen::Matrix<Scalar, N, N>::Identity());
+
+    // a non-unitary starting rotation (e.g. a mixing matrix which has
+    // not been calculated yet) is replaced by the identity
+    if (!z.allFinite() || (z * z.adjoint() - unity).norm() > 1e3 * N * EPSMCH)
+	z = unity;
+
+    Eigen::Array<Real, N, 1> wi;
+    Real wi_errbd = 0;
+
+    // eigenvalues and eigenvectors of m[idx]
+    if (!diagonalize_hermitian_jacobi(m[idx], wi, Eigen::Matrix<Scalar, N, N>(z), &z, &wi_errbd))
+	fs_diagonalize_hermitian_errbd(m[idx], wi, &z, &wi_errbd);
+
+    w[idx] = wi[idx];
+    if (w_errbd) *w_errbd = wi_errbd;
+
+    // only eigenvalues of the others, starting from the rotation of m[idx]
+    for (int i = 0; i < N; i++) {
+	if (i == idx) continue;
+
+	if (!diagonalize_hermitian_jacobi(m[i], wi, z, static_cast<Eigen::Matrix<Scalar, N, N>*>(0), &wi_errbd))
+	    fs_diagonalize_hermitian_errbd(m[i], wi, static_cast<Eigen::Matrix<Scalar, N, N>*>(0), &wi_errbd);
+
+	w[i] = wi[i];
+	if (w_errbd) *w_errbd = std::max(*w_errbd, wi_errbd);
+    }
+}
+
+/**
+ * Diagonalizes the N hermitian N-by-N matrices m[0], ..., m[N-1], of
+ * which only the i-th eigenvalue of m[i] is needed.  This is the case
+ * for the momentum-dependent mass matrices M(p_i) of the pole mass
+ * calculation, where p_i is the mass of the i-th eigenstate.
+ *
+ * The matrices are diagonalized with Jacobi rotations.  First m[idx]
+ * is diagonalized, starting from the rotation z, which should
+ * therefore contain an approximation of the result on input, e.g. the
+ * tree-level mixing matrix.  If z is not unitary, the identity is used
+ * instead.  All other matrices are then diagonalized starting from the
+ * rotation of m[idx].  If the Jacobi sweeps do not converge,
+ * fs_diagonalize_hermitian() is used as fallback.
+ *
+ * On output w[i] is the i-th eigenvalue of m[i], where the
+ * eigenvalues are arranged so that their absolute values are in
+ * ascending order, and z is the unitary matrix which diagonalizes
+ * m[idx] in the convention of fs_diagonalize_hermitian().
+ *
+ * @tparam        Real   type of real and imaginary parts of Scalar
+ * @tparam        Scalar type of elements of m and z
+ * @tparam        N      number of rows and columns in m and z
+ * @param[in]     m      array of N N-by-N matrices to be diagonalized
+ * @param[out]    w      array of length N to contain the eigenvalues
+ * @param[in,out] z      N-by-N unitary matrix
+ * @param[in]     idx    index of the matrix whose rotation is returned in z
+ */
+template<class Real, class Scalar, int N>
+void fs_diagonalize_hermitian_batch
+(const std::array<Eigen::Matrix<Scalar, N, N>, std::size_t(N)>& m,
+ Eigen::Array<Real, N, 1>& w,
+ Eigen::Matrix<Scalar, N, N>& z,
+ int idx)
+{
+    fs_diagonalize_hermitian_batch_errbd(m, w, z, idx);
+}
+
+/**
+ * Same as fs_diagonalize_hermitian_batch(m, w, z, idx) except that
+ * an approximate error bound for the eigenvalues is returned as
+ * well.
+ *
+ * @param[out] w_errbd approximate error bound for the elements of w
+ *
+ * See the documentation of fs_diagonalize_hermitian_batch(m, w, z, idx)
+ * for the other parameters.
+ */
+template<class Real, class Scalar, int N>
+void fs_diagonalize_hermitian_batch
+(const std::array<Eigen::Matrix<Scalar, N, N>, std::size_t(N)>& m,
+ Eigen::Array<Real, N, 1>& w,
+ Eigen::Matrix<Scalar, N, N>& z,
+ int idx,
+ Real& w_errbd)
+{
+    fs_diagonalize_hermitian_batch_errbd(m, w, z, idx, &w_errbd);
+}
+
 } // namespace flexiblesusy
 
 #endif // linalg2_hpp
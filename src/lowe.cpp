@@ -24,13 +24,23 @@
 */
 
 #include "lowe.h"
+#include "config.h"
 #include "ew_input.hpp"
 #include "error.hpp"
 #include "wrappers.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <map>
+#include <vector>
+
+#ifdef ENABLE_THREADS
+#  include <mutex>
+#endif
 
 namespace softsusy {
 
@@ -57,6 +67,94 @@ double getRunMtFromMz(double poleMt, double asMZ, double mz) {
   return getRunMt(poleMt, getAsmt(poleMt, asMZ, mz));
 }
 
+/**
+ * @class QedQcd_cache
+ * @brief process-wide cache of the results of QedQcd::to()
+ *
+ * The key consists of the bit patterns of all quantities the result
+ * of QedQcd::to() depends on, i.e. the input parameters, the initial
+ * running parameters, scale and loop orders, the pole b mass as well
+ * as the target scale, the precision goal and the maximum number of
+ * iterations.  Therefore, a cached result is identical to the
+ * result of the iteration.
+ */
+class QedQcd_cache {
+public:
+   using Key = std::vector<std::uint64_t>;
+
+   /// converged running state
+   struct Value {
+      Eigen::ArrayXd parameters{}; ///< running parameters
+      double scale{0.};            ///< renormalization scale
+      double mbPole{0.};           ///< pole b mass
+   };
+
+   bool find(const Key& key, Value& value)
+   {
+#ifdef ENABLE_THREADS
+      std::lock_guard<std::mutex> lock(mutex);
+#endif
+      const auto it = entries.find(key);
+      if (it == entries.end()) {
+         statistics.misses++;
+         return false;
+      }
+      statistics.hits++;
+      value = it->second;
+      return true;
+   }
+
+   void insert(const Key& key, const Value& value)
+   {
+#ifdef ENABLE_THREADS
+      std::lock_guard<std::mutex> lock(mutex);
+#endif
+      if (entries.size() >= max_size)
+         entries.clear();
+      entries[key] = value;
+   }
+
+   void clear()
+   {
+#ifdef ENABLE_THREADS
+      std::lock_guard<std::mutex> lock(mutex);
+#endif
+      entries.clear();
+      statistics = QedQcd::Cache_statistics();
+   }
+
+   QedQcd::Cache_statistics get_statistics()
+   {
+#ifdef ENABLE_THREADS
+      std::lock_guard<std::mutex> lock(mutex);
+#endif
+      return statistics;
+   }
+
+   std::atomic<bool> enabled{true}; ///< cache is enabled
+
+private:
+   static const std::size_t max_size = 1000; ///< maximum number of entries
+   std::map<Key, Value> entries{};
+   QedQcd::Cache_statistics statistics{};
+#ifdef ENABLE_THREADS
+   std::mutex mutex{};
+#endif
+};
+
+QedQcd_cache& get_cache()
+{
+   static QedQcd_cache cache;
+   return cache;
+}
+
+void append_bits(QedQcd_cache::Key& key, double x)
+{
+   std::uint64_t bits = 0;
+   std::memcpy(&bits, &x, sizeof(bits));
+   key.push_back(bits);
+}
+
 } // anonymous namespace
 
 const std::array<std::string, NUMBER_OF_LOW_ENERGY_INPUT_PARAMETERS> QedQcd_input_parmeter_names = {
@@ -129,12 +227,17 @@ void QedQcd::set(const Eigen::ArrayXd& y)
 Eigen::ArrayXd QedQcd::beta() const
 {
    Eigen::ArrayXd dydx(a.size() + mf.size());
+   fill_beta(dydx);
+   return dydx;
+}
+
+void QedQcd::fill_beta(Eigen::Ref<Eigen::ArrayXd> dydx) const
+{
    dydx(0) = qedBeta();
    dydx(1) = qcdBeta();
    const auto y = massBeta();
    for (int i = 0; i < y.size(); i++)
       dydx(i + 2) = y(i);
-   return dydx;
 }
 
 void QedQcd::runto_safe(double scale, double eps)
@@ -343,11 +446,82 @@ void QedQcd::toMz()
  * This function can be called multiple times, leading to the same
  * result.
  *
+ * If the cache is enabled (see enable_cache()), the converged
+ * running parameters are stored in a process-wide cache and are
+ * re-used if this function is called again for an identical object
+ * with identical arguments, e.g. for each point of a parameter scan
+ * with fixed SMINPUTS.  The cache is bypassed if a custom RG
+ * integrator is used or if the RG trajectory is recorded.
+ *
  * @param scale target renormalization scale
  * @param precision_goal precision goal
  * @param max_iterations maximum number of iterations
  */
-void QedQcd::to(double scale, double precision_goal, int max_iterations) {
+void QedQcd::to(double scale, double precision_goal, int max_iterations)
+{
+   auto& cache = get_cache();
+
+   if (!cache.enabled || !has_default_integrator() || get_trajectory_recording()) {
+      to_uncached(scale, precision_goal, max_iterations);
+      return;
+   }
+
+   const auto parameters = get();
+
+   QedQcd_cache::Key key;
+   key.reserve(input.size() + parameters.size() + 10);
+   for (int i = 0; i < input.size(); i++)
+      append_bits(key, input(i));
+   for (int i = 0; i < parameters.size(); i++)
+      append_bits(key, parameters(i));
+   append_bits(key, get_scale());
+   append_bits(key, mbPole);
+   append_bits(key, get_loops());
+   append_bits(key, get_thresholds());
+   append_bits(key, get_zero_threshold());
+   append_bits(key, get_min_tolerance());
+   append_bits(key, scale);
+   append_bits(key, precision_goal);
+   append_bits(key, max_iterations);
+
+   QedQcd_cache::Value value;
+
+   if (cache.find(key, value)) {
+      set(value.parameters);
+      set_scale(value.scale);
+      mbPole = value.mbPole;
+      return;
+   }
+
+   to_uncached(scale, precision_goal, max_iterations);
+
+   value.parameters = get();
+   value.scale = get_scale();
+   value.mbPole = mbPole;
+   cache.insert(key, value);
+}
+
+void QedQcd::enable_cache(bool flag)
+{
+   get_cache().enabled = flag;
+}
+
+bool QedQcd::is_cache_enabled()
+{
+   return get_cache().enabled;
+}
+
+void QedQcd::clear_cache()
+{
+   get_cache().clear();
+}
+
+QedQcd::Cache_statistics QedQcd::get_cache_statistics()
+{
+   return get_cache().get_statistics();
+}
+
+void QedQcd::to_uncached(double scale, double precision_goal, int max_iterations) {
    int it = 0;
    bool converged = false;
    auto qedqcd_old(get()), qedqcd_new(get());
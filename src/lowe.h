@@ -80,6 +80,8 @@ private:
 
   /// calculates pole bottom mass given alpha_s(Mb)^{MSbar} from running b mass
   double extractPoleMb(double asMb);
+  /// performs the iteration of to() without cache
+  void to_uncached(double scale, double tol, int max_iterations);
 
 public:
   QedQcd();
@@ -93,6 +95,7 @@ public:
   virtual Eigen::ArrayXd get() const override;
   virtual void set(const Eigen::ArrayXd&) override;
   virtual Eigen::ArrayXd beta() const override;
+  virtual void fill_beta(Eigen::Ref<Eigen::ArrayXd>) const override;
 
   void setPoleMt(double mt) { input(Mt_pole) = mt; } ///< set pole top mass
   void setPoleMb(double mb) { mbPole = mb; } ///< set pole bottom mass
@@ -192,6 +195,23 @@ public:
   void toMz();
   /// Evolves object to given scale.
   void to(double scale, double tol = 1e-5, int max_iterations = 20);
+
+  /// hit and miss counters of the cache of to()
+  struct Cache_statistics {
+     long hits{0};   ///< number of calls answered from the cache
+     long misses{0}; ///< number of calls which did the full iteration
+     /// returns the fraction of calls answered from the cache
+     double hit_rate() const { return hits + misses > 0 ? static_cast<double>(hits) / (hits + misses) : 0.; }
+  };
+
+  /// enables/disables the process-wide cache of to() (enabled by default)
+  static void enable_cache(bool);
+  /// returns true if the cache of to() is enabled
+  static bool is_cache_enabled();
+  /// removes all cached results of to() and resets the statistics
+  static void clear_cache();
+  /// returns the hit and miss counters of the cache of to()
+  static Cache_statistics get_cache_statistics();
   /// guess coupling constants {alpha_1, alpha_2, alpha_3} in SM(5)
   Eigen::Array<double,3,1> guess_alpha_SM5(double scale) const;
 };
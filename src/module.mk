@@ -10,6 +10,7 @@ LIBFLEXI_SRC := \
 		$(DIR)/build_info.cpp \
 		$(DIR)/bvp_solver_problems.cpp \
 		$(DIR)/ckm.cpp \
+		$(DIR)/columnar_io.cpp \
 		$(DIR)/command_line_options.cpp \
 		$(DIR)/composite_convergence_tester.cpp \
 		$(DIR)/database.cpp \
@@ -27,13 +28,17 @@ LIBFLEXI_SRC := \
 		$(DIR)/physical_input.cpp \
 		$(DIR)/pmns.cpp \
 		$(DIR)/problems.cpp \
+		$(DIR)/profiling.cpp \
 		$(DIR)/pv.cpp \
+		$(DIR)/rg_trajectory.cpp \
 		$(DIR)/rkf_integrator.cpp \
 		$(DIR)/scan.cpp \
 		$(DIR)/slha_io.cpp \
+		$(DIR)/slha_reader.cpp \
 		$(DIR)/spectrum_generator_problems.cpp \
 		$(DIR)/spectrum_generator_settings.cpp \
 		$(DIR)/string_utils.cpp \
+		$(DIR)/task_graph.cpp \
 		$(DIR)/threshold_corrections.cpp \
 		$(DIR)/threshold_loop_functions.cpp \
 		$(DIR)/weinberg_angle.cpp \
@@ -47,11 +52,13 @@ LIBFLEXI_HDR := \
 		$(DIR)/bvp_solver_problems.hpp \
 		$(DIR)/cextensions.hpp \
 		$(DIR)/ckm.hpp \
+		$(DIR)/columnar_io.hpp \
 		$(DIR)/command_line_options.hpp \
 		$(DIR)/composite_convergence_tester.hpp \
 		$(DIR)/compound_constraint.hpp \
 		$(DIR)/concatenate.hpp \
 		$(DIR)/constraint.hpp \
+		$(DIR)/continuation.hpp \
 		$(DIR)/convergence_tester.hpp \
 		$(DIR)/convergence_tester_drbar.hpp \
 		$(DIR)/coupling_monitor.hpp \
@@ -87,9 +94,11 @@ LIBFLEXI_HDR := \
 		$(DIR)/pmns.hpp \
 		$(DIR)/pp_map.hpp \
 		$(DIR)/problems.hpp \
+		$(DIR)/profiling.hpp \
 		$(DIR)/pv.hpp \
 		$(DIR)/raii.hpp \
 		$(DIR)/rg_flow.hpp \
+		$(DIR)/rg_trajectory.hpp \
 		$(DIR)/rk.hpp \
 		$(DIR)/rkf_integrator.hpp \
 		$(DIR)/root_finder.hpp \
@@ -98,10 +107,14 @@ LIBFLEXI_HDR := \
 		$(DIR)/single_scale_constraint.hpp \
 		$(DIR)/single_scale_matching.hpp \
 		$(DIR)/slha_io.hpp \
+		$(DIR)/slha_reader.hpp \
 		$(DIR)/spectrum_generator_problems.hpp \
 		$(DIR)/spectrum_generator_settings.hpp \
 		$(DIR)/string_utils.hpp \
 		$(DIR)/sum.hpp \
+		$(DIR)/table_interpolator.hpp \
+		$(DIR)/task_context.hpp \
+		$(DIR)/task_graph.hpp \
 		$(DIR)/thread_pool.hpp \
 		$(DIR)/threshold_corrections.hpp \
 		$(DIR)/threshold_loop_functions.hpp \
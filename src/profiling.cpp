@@ -0,0 +1,97 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#include "profiling.hpp"
+
+#ifdef ENABLE_PROFILING
+
+#include "task_context.hpp"
+
+/**
+ * @file profiling.cpp
+ * @brief implementation of the profiling record
+ *
+ * Each thread refers to the record it currently records into via a
+ * slot of its Task_context, which is inherited by the tasks it
+ * submits to a Thread_pool.  If multi-threading is enabled, each
+ * record is protected by a mutex.
+ */
+
+namespace flexiblesusy {
+namespace profiling {
+
+namespace {
+
+/// slot of the Task_context, which holds the record of the calling thread
+const std::size_t record_slot = Task_context::reserve_slot();
+
+} // anonymous namespace
+
+#ifdef ENABLE_THREADS
+#define LOCK_RECORD std::lock_guard<std::mutex> lock(mutex)
+#else
+#define LOCK_RECORD
+#endif
+
+/**
+ * Adds one call of the code section with the given name and the
+ * given wall time.
+ *
+ * @param name name of the code section
+ * @param time wall time in seconds
+ */
+void Record::add(const std::string& name, double time)
+{
+   LOCK_RECORD;
+   auto& timing = report[name];
+   timing.calls++;
+   timing.time += time;
+}
+
+void Record::clear()
+{
+   LOCK_RECORD;
+   report.clear();
+}
+
+Report Record::get_report() const
+{
+   LOCK_RECORD;
+   return report;
+}
+
+Record* current_record()
+{
+   return static_cast<Record*>(Task_context::current().get(record_slot));
+}
+
+Scoped_record::Scoped_record(Record* record)
+   : previous(current_record())
+{
+   Task_context::current().set(record_slot, record);
+}
+
+Scoped_record::~Scoped_record()
+{
+   Task_context::current().set(record_slot, previous);
+}
+
+} // namespace profiling
+} // namespace flexiblesusy
+
+#endif
@@ -0,0 +1,185 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef PROFILING_H
+#define PROFILING_H
+
+#include "config.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#if defined(ENABLE_PROFILING) && defined(ENABLE_THREADS)
+#include <mutex>
+#endif
+
+/**
+ * @file profiling.hpp
+ * @brief run-time profiling of instrumented code sections
+ *
+ * The following macro is available:
+ *
+ * PROFILE_SCOPE(name)  records the wall time and the number of calls
+ *                      of the enclosing scope under the given name
+ *
+ * The macro expands to nothing, unless ENABLE_PROFILING is defined
+ * in config.h (configure option --enable-profiling).  If it is
+ * defined, the timings are recorded into the record of the calling
+ * thread, which is installed via a Scoped_record.  Without a record
+ * nothing is recorded.  Each run of a spectrum generator installs its
+ * own record, such that concurrent runs do not interfere.  Without
+ * ENABLE_PROFILING the classes Record, Scoped_record and Scoped_timer
+ * do nothing.
+ */
+
+namespace flexiblesusy {
+namespace profiling {
+
+/// wall time and number of calls of an instrumented code section
+struct Timing {
+   long calls{0};   ///< number of calls
+   double time{0.}; ///< accumulated wall time in seconds
+};
+
+/// timings of all instrumented code sections, sorted by name
+using Report = std::map<std::string, Timing>;
+
+#ifdef ENABLE_PROFILING
+
+/**
+ * @class Record
+ * @brief timings of the instrumented code sections of one run
+ *
+ * A record may be filled from several threads concurrently, if
+ * multi-threading is enabled.
+ */
+class Record {
+public:
+   void add(const std::string&, double); ///< records one call
+   void clear();                         ///< removes all recorded timings
+   Report get_report() const;            ///< returns all recorded timings
+
+private:
+   Report report{};
+#ifdef ENABLE_THREADS
+   mutable std::mutex mutex{};
+#endif
+};
+
+/// returns the record of the calling thread (nullptr if none)
+Record* current_record();
+
+/**
+ * @class Scoped_record
+ * @brief installs a record for the calling thread during its lifetime
+ *
+ * The previously installed record is restored by the destructor.  A
+ * null pointer switches off the recording in the calling thread.
+ * Tasks submitted to a Thread_pool record into the record of the
+ * submitting thread.
+ */
+class Scoped_record {
+public:
+   explicit Scoped_record(Record*);
+   Scoped_record(const Scoped_record&) = delete;
+   Scoped_record& operator=(const Scoped_record&) = delete;
+   ~Scoped_record();
+
+private:
+   Record* previous{nullptr};
+};
+
+/**
+ * @class Scoped_timer
+ * @brief records the wall time of its lifetime
+ *
+ * The time is recorded into the record of the calling thread at
+ * construction.  If the given name is empty or no record is
+ * installed, nothing is recorded.
+ */
+class Scoped_timer {
+public:
+   explicit Scoped_timer(std::string name_)
+      : name(std::move(name_))
+      , record(name.empty() ? nullptr : current_record())
+   {
+      if (record)
+         start = std::chrono::steady_clock::now();
+   }
+   Scoped_timer(const Scoped_timer&) = delete;
+   Scoped_timer& operator=(const Scoped_timer&) = delete;
+   ~Scoped_timer()
+   {
+      if (record) {
+         const std::chrono::duration<double> duration =
+            std::chrono::steady_clock::now() - start;
+         record->add(name, duration.count());
+      }
+   }
+
+private:
+   std::string name;
+   Record* record{nullptr};
+   std::chrono::steady_clock::time_point start{};
+};
+
+#else
+
+// Without profiling nothing is recorded and the following classes
+// do nothing.
+
+class Record {
+public:
+   void add(const std::string&, double) {}
+   void clear() {}
+   Report get_report() const { return {}; }
+};
+
+inline Record* current_record() { return nullptr; }
+
+class Scoped_record {
+public:
+   explicit Scoped_record(Record*) {}
+   Scoped_record(const Scoped_record&) = delete;
+   Scoped_record& operator=(const Scoped_record&) = delete;
+};
+
+class Scoped_timer {
+public:
+   explicit Scoped_timer(const std::string&) {}
+   Scoped_timer(const Scoped_timer&) = delete;
+   Scoped_timer& operator=(const Scoped_timer&) = delete;
+};
+
+#endif
+
+} // namespace profiling
+} // namespace flexiblesusy
+
+#ifdef ENABLE_PROFILING
+#define PROFILING_CONCAT_IMPL(a,b) a##b
+#define PROFILING_CONCAT(a,b) PROFILING_CONCAT_IMPL(a,b)
+#define PROFILE_SCOPE(name)                                             \
+   flexiblesusy::profiling::Scoped_timer PROFILING_CONCAT(profiling_timer_, __LINE__)( \
+      flexiblesusy::profiling::current_record() ? std::string(name) : std::string())
+#else
+#define PROFILE_SCOPE(name)
+#endif
+
+#endif
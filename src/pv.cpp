@@ -16,12 +16,16 @@
 // <http://www.gnu.org/licenses/>.
 // ====================================================================
 
+#include <array>
 #include <limits>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include "derivative.hpp"
 #include "logger.hpp"
 #include "pv.hpp"
+#include "task_context.hpp"
 
 #ifdef ENABLE_LOOPTOOLS
 #  include <clooptools.h>
@@ -31,249 +35,223 @@
 #  include "numerics.h"
 #endif
 
+#ifdef ENABLE_THREADS
+#  include <mutex>
+#endif
+
 namespace flexiblesusy {
 
 namespace passarino_veltman {
 
 using namespace std;
 
-#ifdef ENABLE_LOOPTOOLS
-
 namespace {
 
-struct Initialize_looptools {
-    Initialize_looptools() {
-	ltini();
+/// slot of the Task_context, which is non-null if the memo cache is
+/// enabled in the calling thread
+const std::size_t cache_slot = Task_context::reserve_slot();
+
+/// value of the slot if the memo cache is enabled
+char cache_enabled_tag = 0;
+
+/**
+ * @class Loop_function_cache
+ * @brief direct-mapped memo cache for the real loop functions
+ *
+ * The cache stores the values of ReA0, ReB0, ReB1 and ReB00, keyed
+ * on the function and on (p^2, m1^2, m2^2, Q^2).  A new entry
+ * overwrites the entry with the same hash.  One cache exists per
+ * thread, so no synchronization is necessary.
+ */
+class Loop_function_cache {
+public:
+    enum Function : unsigned { a0, b0, b1, b00 };
+
+    template <class F>
+    double get(Function, double, double, double, double, F&&) noexcept;
+
+private:
+    struct Entry {
+	double p2, m2a, m2b, scl2, value;
+	unsigned function;
+	bool valid;
+    };
+
+    static constexpr std::size_t size = 1024; ///< must be a power of 2
+    std::array<Entry, size> entries{};
+
+    static std::uint64_t bits(double x) noexcept {
+	std::uint64_t b;
+	std::memcpy(&b, &x, sizeof(b));
+	return b;
     }
-    ~Initialize_looptools() {
-	ltexi();
-    }
-} initialize_looptools;
-
-const double deriv_eps = 1e-5; ///< epsilon for derivatives
+    static std::size_t hash(Function, double, double, double, double) noexcept;
+};
 
-} // anonymous namespace
-
-complex<double> A0(double m2, double scl2) noexcept
+std::size_t Loop_function_cache::hash(
+    Function f, double p2, double m2a, double m2b, double scl2) noexcept
 {
-    setmudim(scl2);
-    return ::A0(m2);
+    std::uint64_t h = 0xcbf29ce484222325ULL ^ f;
+    for (const auto x: { p2, m2a, m2b, scl2 }) {
+	h ^= bits(x);
+	h *= 0x100000001b3ULL;
+	h ^= h >> 29;
+    }
+    return static_cast<std::size_t>(h) & (size - 1);
 }
 
-complex<double> B0(double p2, double m2a, double m2b, double scl2) noexcept
+template <class F>
+double Loop_function_cache::get(
+    Function f, double p2, double m2a, double m2b, double scl2, F&& eval) noexcept
 {
-    setmudim(scl2);
-    return ::B0(p2, m2a, m2b);
-}
+    Entry& e = entries[hash(f, p2, m2a, m2b, scl2)];
 
-complex<double> B1(double p2, double m2a, double m2b, double scl2) noexcept
-{
-    setmudim(scl2);
-    return ::B1(p2, m2a, m2b);
-}
+    if (e.valid && e.function == f && e.p2 == p2 && e.m2a == m2a &&
+	e.m2b == m2b && e.scl2 == scl2)
+	return e.value;
 
-complex<double> B00(double p2, double m2a, double m2b, double scl2) noexcept
-{
-    setmudim(scl2);
-    return ::B00(p2, m2a, m2b);
-}
+    const double value = eval();
+    e = Entry{p2, m2a, m2b, scl2, value, f, true};
 
-complex<double> A0(complex<double> m2, double scl2) noexcept
-{
-    setmudim(scl2);
-    return ::A0C(m2);
+    return value;
 }
 
-complex<double> B0
-(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
+/// evaluates eval(), looking up the result in the cache of the
+/// calling thread if the cache is enabled
+template <class F>
+double cached(Loop_function_cache::Function f,
+	      double p2, double m2a, double m2b, double scl2, F&& eval) noexcept
 {
-    setmudim(scl2);
-    return ::B0C(p2, m2a, m2b);
-}
+    if (!is_cache_enabled())
+	return eval();
 
-complex<double> B1
-(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
-{
-    setmudim(scl2);
-    return ::B1C(p2, m2a, m2b);
-}
+    static thread_local Loop_function_cache cache;
 
-complex<double> B00
-(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
-{
-    setmudim(scl2);
-    return ::B00C(p2, m2a, m2b);
+    return cache.get(f, p2, m2a, m2b, scl2, eval);
 }
 
-complex<double> D1B0(double p2, double m2a, double m2b) noexcept
+// Thread safety of the backends:
+//
+// - built-in (softsusy) functions: reentrant, no locking.
+//
+// - FF: The real A0, B0, B1 and B00 are evaluated in C++ (A0
+//   analytically, the others with Denner's implementation, whose
+//   Fortran helpers only read constants set by ltini()) and need no
+//   locking.  The complex functions and D1B0 call into FF, which
+//   writes intermediate results and error flags to common blocks, so
+//   these calls are serialized.
+//
+// - LoopTools: The real A0, B0, B1 and B00 are evaluated in C++ as
+//   for FF and need no locking.  The complex functions use the global
+//   cache and error flags of LoopTools, so these calls are
+//   serialized.
+#if defined(ENABLE_THREADS) && (defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE))
+std::mutex library_mutex;
+#  define LOCK_LIBRARY \
+    std::lock_guard<std::mutex> lock(library_mutex)
+#else
+#  define LOCK_LIBRARY
+#endif
+
+} // anonymous namespace
+
+void enable_cache(bool flag) noexcept
 {
-    const auto f = [m2a,m2b](double p2) { return B0(p2, m2a, m2b, 1.0); };
-    return derivative_central<0>(f, p2, deriv_eps);
+    Task_context::current().set(cache_slot, flag ? &cache_enabled_tag : nullptr);
 }
 
-complex<double> D1B0
-(complex<double> p2, complex<double> m2a, complex<double> m2b) noexcept
+bool is_cache_enabled() noexcept
 {
-    const auto re_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).real(); };
-    const auto im_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).imag(); };
-
-    const auto dudx = derivative_central<0>(re_f, p2.real(), deriv_eps);
-    const auto dvdx = derivative_central<0>(im_f, p2.real(), deriv_eps);
-
-    return {dudx, dvdx};
+    return Task_context::current().get(cache_slot) != nullptr;
 }
 
-#elif defined(ENABLE_FFLITE)
+#if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
 
 namespace {
 
 const double nan = numeric_limits<double>::quiet_NaN();
-const double deriv_eps = 1e-5; ///< epsilon for derivatives
 
 // see src/include/ff.h in LoopTools
 const double acc = 1e-13;
 const double eps = 1e-22;
 const complex<double> cIeps(0.0, 1e-50);
 
-struct Initialize_looptools {
-    Initialize_looptools() {
-	ltini_();
-    }
-    ~Initialize_looptools() {
-	ltexi_();
-    }
-} initialize_looptools;
-
-template<class T> T sqr(T x) noexcept { return x*x; }
 template<class T> T sign(T a, T b) noexcept { return b >= 0 ? std::abs(a) : - std::abs(a); }
 
-namespace FF {
-
-complex<double> A0(double m2, double scl2) noexcept
-{
-    complex<double> ca0;
-    int ier;
-    ljffxa0_(ca0, 0, scl2, m2, ier);
-    return ca0;
-}
-
-complex<double> B0(double p2, double m2a, double m2b, double scl2) noexcept
-{
-    complex<double> cb0;
-    int ier;
-    ljffxb0_(cb0, 0, scl2, p2, m2a, m2b, ier);
-    return cb0;
-}
+namespace AD {
 
-complex<double> B1(double p2, double m2a, double m2b, double scl2) noexcept
-{
-    complex<double> cb1;
-    int ier;
-    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
-    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
-    double piDpj[9];
-    ljffdot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
-    ljffxb1_(cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
-    return cb1;
-}
+#ifdef ENABLE_FFLITE
 
-complex<double> B00(double p2, double m2a, double m2b, double scl2) noexcept
+complex<double> fpv
+(const int& n, const std::complex<double>& x, const std::complex<double>& y) noexcept
 {
-    complex<double> cb2i[2];
-    int ier;
-    complex<double> cb1 = B1(p2, m2a, m2b, scl2);
-    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
-    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
-    double piDpj[9];
-    ljffdot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
-    ljffxb2p_(cb2i, cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
-    return cb2i[1];
+    complex<double> res; sub_fpv_(res, n, x, y); return res;
 }
 
-complex<double> A0
-(complex<double> m2, double scl2) noexcept
+complex<double> yfpv
+(const int& n, const std::complex<double>& x, const std::complex<double>& y) noexcept
 {
-    complex<double> ca0;
-    int ier;
-    ljffca0_(ca0, 0, scl2, m2, ier);
-    return ca0;
+    complex<double> res; sub_yfpv_(res, n, x, y); return res;
 }
 
-complex<double> B0
-(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
+complex<double> fth
+(const int& n, const std::complex<double>& x, const std::complex<double>& y) noexcept
 {
-    complex<double> cb0;
-    int ier;
-    ljffcb0_(cb0, 0, scl2, p2, m2a, m2b, ier);
-    return cb0;
+    complex<double> res; sub_fth_(res, n, x, y); return res;
 }
 
-complex<double> B1
-(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
-{
-    complex<double> cb1;
-    int ier;
-    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
-    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
-    complex<double> piDpj[9];
-    ljffcot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
-    ljffcb1_(cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
-    return cb1;
-}
+#else
 
-complex<double> B00
-(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
-{
-    complex<double> cb2i[2];
-    int ier;
-    complex<double> cb1 = B1(p2, m2a, m2b, scl2);
-    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
-    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
-    complex<double> piDpj[9];
-    ljffcot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
-    ljffcb2p_(cb2i, cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
-    return cb2i[1];
-}
+// C++ versions of fpv() and fth() from BcoeffAD.F in LoopTools.
+// LoopTools implements them as complex-valued Fortran functions,
+// whose calling convention depends on the Fortran compiler.
 
-complex<double> D1B0(double p2, double m2a, double m2b) noexcept
-{
-    const auto f = [m2a,m2b](double p2) { return B0(p2, m2a, m2b, 1.0); };
-    return derivative_central<0>(f, p2, deriv_eps);
-}
+// see ffinit.F in LoopTools
+const double precx = 4*numeric_limits<double>::epsilon();
 
-complex<double> D1B0
-(complex<double> p2, complex<double> m2a, complex<double> m2b) noexcept
+complex<double> fpv(int n, complex<double> x, complex<double> y) noexcept
 {
-    const auto re_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).real(); };
-    const auto im_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).imag(); };
-
-    const auto dudx = derivative_central<0>(re_f, p2.real(), deriv_eps);
-    const auto dvdx = derivative_central<0>(im_f, p2.real(), deriv_eps);
+    if (std::abs(x) < 5) {
+	if (n == 0)
+	    return -log(-y/x);
+	if (std::abs(x) < acc)
+	    return -1.0/n;
+	complex<double> xm = -log(-y/x);
+	for (int m = 1; m <= n; m++)
+	    xm = x*xm - 1.0/m;
+	return xm;
+    }
 
-    return {dudx, dvdx};
+    complex<double> res = 0.0, xm = 1.0;
+    for (int m = 1; m <= 50; m++) {
+	xm = xm/x;
+	res += xm/static_cast<double>(m + n);
+	if (std::abs(xm) < precx*std::abs(res))
+	    break;
+    }
+    return res;
 }
 
-} // namespace FF
-
-namespace AD {
-
-complex<double> fpv
-(const int& n, const std::complex<double>& x, const std::complex<double>& y) noexcept
+complex<double> fth(int n, complex<double> x, complex<double> y) noexcept
 {
-    complex<double> res; sub_fpv_(res, n, x, y); return res;
-}
+    if (std::abs(x) > 1e4) {
+	complex<double> res = 0.0, xm = 1.0;
+	for (int m = n; m <= 30 + n; m++) {
+	    xm = xm/x;
+	    res -= xm/static_cast<double>(m*(m + 1));
+	    if (std::abs(xm) < precx*std::abs(res))
+		break;
+	}
+	return res;
+    }
 
-complex<double> yfpv
-(const int& n, const std::complex<double>& x, const std::complex<double>& y) noexcept
-{
-    complex<double> res; sub_yfpv_(res, n, x, y); return res;
+    complex<double> res = fpv(1, y, x);
+    for (int m = 1; m <= n - 1; m++)
+	res = x*res + 1.0/(m*(m + 1));
+    return res;
 }
 
-complex<double> fth
-(const int& n, const std::complex<double>& x, const std::complex<double>& y) noexcept
-{
-    complex<double> res; sub_fth_(res, n, x, y); return res;
-}
+#endif
 
 complex<double> xlogx(complex<double> x) noexcept
 {
@@ -415,11 +393,19 @@ complex<double> B(double p2, double m2a, double m2b, double scl2) noexcept
 
 } // namespace AD
 
-} // namespace
+} // anonymous namespace
+
+// The real-argument functions are evaluated in C++ for both backends,
+// so they do not touch the global state of LoopTools or FF and need
+// no locking.
 
+// see ffxa0.F in LoopTools
 complex<double> A0(double m2, double scl2) noexcept
 {
-    return FF::A0(m2, scl2);
+    const double x = scl2 != 0 ? m2/scl2 : m2;
+    const double log_x = x > numeric_limits<double>::min() ? log(x) : 0.;
+
+    return -m2*(log_x - 1);
 }
 
 // LoopTools evaluates B functions (by default) using Ansgar Denner's
@@ -451,118 +437,317 @@ complex<double> B00(double p2, double m2a, double m2b, double scl2) noexcept
     // return FF::B00(p2, m2a, m2b, scl2);
 }
 
+#endif // defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
+
+#ifdef ENABLE_LOOPTOOLS
+
+namespace {
+
+struct Initialize_looptools {
+    Initialize_looptools() {
+	ltini();
+	setmudim(1.0);
+    }
+    ~Initialize_looptools() {
+	ltexi();
+    }
+} initialize_looptools;
+
+const double deriv_eps = 1e-5; ///< epsilon for derivatives
+
+} // anonymous namespace
+
+// The renormalization scale of LoopTools is fixed to mudim = 1 at
+// initialization.  The dependence on the scale is restored
+// analytically from the UV divergent parts, so that no global state
+// has to be modified when the loop functions are called.
+
+complex<double> A0(complex<double> m2, double scl2)
+{
+    const double log_scl2 = log(scl2);
+    LOCK_LIBRARY;
+    return ::A0C(m2) + m2*log_scl2;
+}
+
+complex<double> B0
+(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2)
+{
+    const double log_scl2 = log(scl2);
+    LOCK_LIBRARY;
+    return ::B0C(p2, m2a, m2b) + log_scl2;
+}
+
+complex<double> B1
+(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2)
+{
+    const double log_scl2 = log(scl2);
+    LOCK_LIBRARY;
+    return ::B1C(p2, m2a, m2b) - 0.5*log_scl2;
+}
+
+complex<double> B00
+(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2)
+{
+    const double log_scl2 = log(scl2);
+    LOCK_LIBRARY;
+    return ::B00C(p2, m2a, m2b) + (3.0*(m2a + m2b) - p2)/12.0*log_scl2;
+}
+
+complex<double> D1B0(double p2, double m2a, double m2b)
+{
+    const auto f = [m2a,m2b](double p2) { return B0(p2, m2a, m2b, 1.0); };
+    return derivative_central<0>(f, p2, deriv_eps);
+}
+
+complex<double> D1B0
+(complex<double> p2, complex<double> m2a, complex<double> m2b)
+{
+    const auto re_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).real(); };
+    const auto im_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).imag(); };
+
+    const auto dudx = derivative_central<0>(re_f, p2.real(), deriv_eps);
+    const auto dvdx = derivative_central<0>(im_f, p2.real(), deriv_eps);
+
+    return {dudx, dvdx};
+}
+#elif defined(ENABLE_FFLITE)
+
+namespace {
+
+const double deriv_eps = 1e-5; ///< epsilon for derivatives
+
+struct Initialize_looptools {
+    Initialize_looptools() {
+	ltini_();
+    }
+    ~Initialize_looptools() {
+	ltexi_();
+    }
+} initialize_looptools;
+
+namespace FF {
+
+complex<double> A0(double m2, double scl2) noexcept
+{
+    complex<double> ca0;
+    int ier;
+    ljffxa0_(ca0, 0, scl2, m2, ier);
+    return ca0;
+}
+
+complex<double> B0(double p2, double m2a, double m2b, double scl2) noexcept
+{
+    complex<double> cb0;
+    int ier;
+    ljffxb0_(cb0, 0, scl2, p2, m2a, m2b, ier);
+    return cb0;
+}
+
+complex<double> B1(double p2, double m2a, double m2b, double scl2) noexcept
+{
+    complex<double> cb1;
+    int ier;
+    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
+    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
+    double piDpj[9];
+    ljffdot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
+    ljffxb1_(cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
+    return cb1;
+}
+
+complex<double> B00(double p2, double m2a, double m2b, double scl2) noexcept
+{
+    complex<double> cb2i[2];
+    int ier;
+    complex<double> cb1 = B1(p2, m2a, m2b, scl2);
+    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
+    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
+    double piDpj[9];
+    ljffdot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
+    ljffxb2p_(cb2i, cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
+    return cb2i[1];
+}
+
 complex<double> A0
 (complex<double> m2, double scl2) noexcept
 {
-    return FF::A0(m2, scl2);
+    complex<double> ca0;
+    int ier;
+    ljffca0_(ca0, 0, scl2, m2, ier);
+    return ca0;
 }
 
 complex<double> B0
 (complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
 {
-    return FF::B0(p2, m2a, m2b, scl2);
+    complex<double> cb0;
+    int ier;
+    ljffcb0_(cb0, 0, scl2, p2, m2a, m2b, ier);
+    return cb0;
 }
 
 complex<double> B1
 (complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
 {
-    return FF::B1(p2, m2a, m2b, scl2);
+    complex<double> cb1;
+    int ier;
+    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
+    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
+    complex<double> piDpj[9];
+    ljffcot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
+    ljffcb1_(cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
+    return cb1;
 }
 
 complex<double> B00
 (complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2) noexcept
 {
-    return FF::B00(p2, m2a, m2b, scl2);
+    complex<double> cb2i[2];
+    int ier;
+    complex<double> cb1 = B1(p2, m2a, m2b, scl2);
+    complex<double> cb0 = B0(p2, m2a, m2b, scl2);
+    complex<double> ca0i[2] = { A0(m2a, scl2), A0(m2b, scl2) };
+    complex<double> piDpj[9];
+    ljffcot2_(piDpj, p2, m2a, m2b, m2a-p2, m2b-p2, m2a-m2b, ier);
+    ljffcb2p_(cb2i, cb1, cb0, ca0i, p2, m2a, m2b, piDpj, ier);
+    return cb2i[1];
 }
 
 complex<double> D1B0(double p2, double m2a, double m2b) noexcept
 {
-    return FF::D1B0(p2, m2a, m2b);
+    const auto f = [m2a,m2b](double p2) { return B0(p2, m2a, m2b, 1.0); };
+    return derivative_central<0>(f, p2, deriv_eps);
 }
 
 complex<double> D1B0
 (complex<double> p2, complex<double> m2a, complex<double> m2b) noexcept
 {
+    const auto re_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).real(); };
+    const auto im_f = [p2,m2a,m2b](double re_p2) { return B0({re_p2, p2.imag()}, m2a, m2b, 1.0).imag(); };
+
+    const auto dudx = derivative_central<0>(re_f, p2.real(), deriv_eps);
+    const auto dvdx = derivative_central<0>(im_f, p2.real(), deriv_eps);
+
+    return {dudx, dvdx};
+}
+
+} // namespace FF
+
+} // anonymous namespace
+
+complex<double> A0
+(complex<double> m2, double scl2)
+{
+    LOCK_LIBRARY;
+    return FF::A0(m2, scl2);
+}
+
+complex<double> B0
+(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2)
+{
+    LOCK_LIBRARY;
+    return FF::B0(p2, m2a, m2b, scl2);
+}
+
+complex<double> B1
+(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2)
+{
+    LOCK_LIBRARY;
+    return FF::B1(p2, m2a, m2b, scl2);
+}
+
+complex<double> B00
+(complex<double> p2, complex<double> m2a, complex<double> m2b, double scl2)
+{
+    LOCK_LIBRARY;
+    return FF::B00(p2, m2a, m2b, scl2);
+}
+
+complex<double> D1B0(double p2, double m2a, double m2b)
+{
+    LOCK_LIBRARY;
     return FF::D1B0(p2, m2a, m2b);
 }
 
+complex<double> D1B0
+(complex<double> p2, complex<double> m2a, complex<double> m2b)
+{
+    LOCK_LIBRARY;
+    return FF::D1B0(p2, m2a, m2b);
+}
 #endif // defined(ENABLE_FFLITE)
 
 double ReA0(double m2, double scl2) noexcept
 {
+    return cached(Loop_function_cache::a0, 0., m2, 0., scl2, [&] {
 #if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return A0(m2, scl2).real();
+	return A0(m2, scl2).real();
 #else
-    return softsusy::a0(sqrt(m2), sqrt(scl2));
+	return softsusy::a0(sqrt(m2), sqrt(scl2));
 #endif
+    });
 }
 
 double ReB0(double p2, double m2a, double m2b, double scl2) noexcept
 {
+    return cached(Loop_function_cache::b0, p2, m2a, m2b, scl2, [&] {
 #if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return B0(p2, m2a, m2b, scl2).real();
+	return B0(p2, m2a, m2b, scl2).real();
 #else
-    return softsusy::b0(sqrt(p2), sqrt(m2a), sqrt(m2b), sqrt(scl2));
+	return softsusy::b0(sqrt(p2), sqrt(m2a), sqrt(m2b), sqrt(scl2));
 #endif
+    });
 }
 
 double ReB1(double p2, double m2a, double m2b, double scl2) noexcept
 {
+    return cached(Loop_function_cache::b1, p2, m2a, m2b, scl2, [&] {
 #if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return B1(p2, m2a, m2b, scl2).real();
+	return B1(p2, m2a, m2b, scl2).real();
 #else
-    return -softsusy::b1(sqrt(p2), sqrt(m2a), sqrt(m2b), sqrt(scl2));
+	return -softsusy::b1(sqrt(p2), sqrt(m2a), sqrt(m2b), sqrt(scl2));
 #endif
+    });
 }
 
 double ReB00(double p2, double m2a, double m2b, double scl2) noexcept
 {
+    return cached(Loop_function_cache::b00, p2, m2a, m2b, scl2, [&] {
 #if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return B00(p2, m2a, m2b, scl2).real();
+	return B00(p2, m2a, m2b, scl2).real();
 #else
-    return softsusy::b22(sqrt(p2), sqrt(m2a), sqrt(m2b), sqrt(scl2));
+	return softsusy::b22(sqrt(p2), sqrt(m2a), sqrt(m2b), sqrt(scl2));
 #endif
+    });
 }
 
+// For real arguments the real parts of the following combinations
+// are the combinations of the real parts, so they are built from the
+// (possibly cached) functions above for all backends.
+
 double ReB22(double p2, double m2a, double m2b, double scl2) noexcept
 {
-#if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return B22(p2, m2a, m2b, scl2).real();
-#else
     return ReB00(p2, m2a, m2b, scl2) - ReA0(m2a, scl2)/4 - ReA0(m2b, scl2)/4;
-#endif
 }
 
 double ReH0(double p2, double m2a, double m2b, double scl2) noexcept
 {
-#if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return H0(p2, m2a, m2b, scl2).real();
-#else
     return 4*ReB00(p2, m2a, m2b, scl2) + ReG0(p2, m2a, m2b, scl2);
-#endif
 }
 
 double ReF0(double p2, double m2a, double m2b, double scl2) noexcept
 {
-#if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return F0(p2, m2a, m2b, scl2).real();
-#else
     return ReA0(m2a, scl2) - 2*ReA0(m2b, scl2)
 	   - (2*p2 + 2*m2a - m2b) * ReB0(p2, m2a, m2b, scl2);
-#endif
 }
 
 double ReG0(double p2, double m2a, double m2b, double scl2) noexcept
 {
-#if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return G0(p2, m2a, m2b, scl2).real();
-#else
     return (p2 - m2a - m2b) * ReB0(p2, m2a, m2b, scl2)
 	   - ReA0(m2a, scl2) - ReA0(m2b, scl2);
-#endif
 }
 
-double ReD1B0(double p2, double m2a, double m2b) noexcept
+double ReD1B0(double p2, double m2a, double m2b)
 {
 #if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
    return D1B0(p2, m2a, m2b).real();
@@ -571,24 +756,16 @@ double ReD1B0(double p2, double m2a, double m2b) noexcept
 #endif
 }
 
-double ReD1F0(double p2, double m2a, double m2b, double scl2) noexcept
+double ReD1F0(double p2, double m2a, double m2b, double scl2)
 {
-#if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return D1F0(p2, m2a, m2b, scl2).real();
-#else
     return - (2.0*p2 + 2.0*m2a - m2b) * ReD1B0(p2, m2a, m2b)
        - 2.0 * ReB0(p2, m2a, m2b, scl2);
-#endif
 }
 
-double ReD1G0(double p2, double m2a, double m2b, double scl2) noexcept
+double ReD1G0(double p2, double m2a, double m2b, double scl2)
 {
-#if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
-    return D1G0(p2, m2a, m2b, scl2).real();
-#else
     return (p2 - m2a - m2b) * ReD1B0(p2, m2a, m2b)
        + ReB0(p2, m2a, m2b, scl2);
-#endif
 }
 
 } // namespace passarino_veltman
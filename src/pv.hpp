@@ -39,14 +39,48 @@ namespace flexiblesusy {
 
 namespace passarino_veltman {
 
-// functions in LoopTools depend on global variables (such as delta,
-// mu, lambda, minmass as well as the internal cache) and therefore
-// are not thread-safe
-#ifdef ENABLE_LOOPTOOLS
-#  define PVATTR noexcept ATTR(pure)
-#else
-#  define PVATTR noexcept ATTR(const)
-#endif
+// The renormalization scale is always passed explicitly as scl2.
+// PVATTR functions only read global state (the LoopTools settings),
+// therefore they are pure, but not const.  PVATTR_CACHED functions
+// may write to the memo cache of the calling thread.  PVATTR_LOCKED
+// functions may lock a mutex, which serializes the calls into
+// LoopTools or FF and may throw.  See pv.cpp for the thread safety
+// of the backends.
+#define PVATTR noexcept ATTR(pure)
+#define PVATTR_CACHED noexcept
+#define PVATTR_LOCKED
+
+/**
+ * Enables/disables the memo cache of ReA0, ReB0, ReB1 and ReB00 in
+ * the calling thread (disabled by default).  Each thread owns its own
+ * cache, keyed on (p^2, m1^2, m2^2, Q^2).  The cached values are
+ * identical to the computed ones.  Tasks submitted to a Thread_pool
+ * by a thread with enabled cache use the cache, too.
+ *
+ * @param flag true to enable the cache, false to disable it
+ */
+void enable_cache(bool flag) noexcept;
+/// returns true if the memo cache is enabled in the calling thread
+bool is_cache_enabled() noexcept;
+
+/**
+ * @class Scoped_cache
+ * @brief enables/disables the memo cache in the calling thread
+ * during its lifetime
+ *
+ * The previous setting is restored by the destructor.
+ */
+class Scoped_cache {
+public:
+   explicit Scoped_cache(bool flag) noexcept
+      : previous(is_cache_enabled()) { enable_cache(flag); }
+   Scoped_cache(const Scoped_cache&) = delete;
+   Scoped_cache& operator=(const Scoped_cache&) = delete;
+   ~Scoped_cache() { enable_cache(previous); }
+
+private:
+   bool previous{false};
+};
 
 #if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
 
@@ -55,63 +89,63 @@ std::complex<double> B0 (double p2, double m2a, double m2b, double scl2)PVATTR;
 std::complex<double> B1 (double p2, double m2a, double m2b, double scl2)PVATTR;
 std::complex<double> B00(double p2, double m2a, double m2b, double scl2)PVATTR;
 
-std::complex<double> A0 (std::complex<double> m2, double scl2) PVATTR;
+std::complex<double> A0 (std::complex<double> m2, double scl2) PVATTR_LOCKED;
 std::complex<double> B0 (std::complex<double> p2, std::complex<double> m2a,
-			 std::complex<double> m2b, double scl2) PVATTR;
+			 std::complex<double> m2b, double scl2) PVATTR_LOCKED;
 std::complex<double> B1 (std::complex<double> p2, std::complex<double> m2a,
-			 std::complex<double> m2b, double scl2) PVATTR;
+			 std::complex<double> m2b, double scl2) PVATTR_LOCKED;
 std::complex<double> B00(std::complex<double> p2, std::complex<double> m2a,
-			 std::complex<double> m2b, double scl2) PVATTR;
+			 std::complex<double> m2b, double scl2) PVATTR_LOCKED;
 
-template<class T> std::complex<double> B22(T, T, T, double) PVATTR;
-template<class T> std::complex<double> F0 (T, T, T, double) PVATTR;
-template<class T> std::complex<double> G0 (T, T, T, double) PVATTR;
-template<class T> std::complex<double> H0 (T, T, T, double) PVATTR;
+template<class T> std::complex<double> B22(T, T, T, double) PVATTR_LOCKED;
+template<class T> std::complex<double> F0 (T, T, T, double) PVATTR_LOCKED;
+template<class T> std::complex<double> G0 (T, T, T, double) PVATTR_LOCKED;
+template<class T> std::complex<double> H0 (T, T, T, double) PVATTR_LOCKED;
 
 // CHECK: are the following correct complexifications of B22, H0, F0, G0?
 
 template<class T>
-std::complex<double> B22(T p2, T m2a, T m2b, double scl2) noexcept
+std::complex<double> B22(T p2, T m2a, T m2b, double scl2)
 {
     return B00(p2, m2a, m2b, scl2) - A0(m2a, scl2)/4.0 - A0(m2b, scl2)/4.0;
 }
 
 template<class T>
-std::complex<double> F0(T p2, T m2a, T m2b, double scl2) noexcept
+std::complex<double> F0(T p2, T m2a, T m2b, double scl2)
 {
     return A0(m2a, scl2) - 2.0*A0(m2b, scl2)
 	   - (2.0*p2 + 2.0*m2a - m2b) * B0(p2, m2a, m2b, scl2);
 }
 
 template<class T>
-std::complex<double> G0(T p2, T m2a, T m2b, double scl2) noexcept
+std::complex<double> G0(T p2, T m2a, T m2b, double scl2)
 {
     return (p2 - m2a - m2b) * B0(p2, m2a, m2b, scl2)
 	   - A0(m2a, scl2) - A0(m2b, scl2);
 }
 
 template<class T>
-std::complex<double> H0(T p2, T m2a, T m2b, double scl2) noexcept
+std::complex<double> H0(T p2, T m2a, T m2b, double scl2)
 {
     return 4.0*B00(p2, m2a, m2b, scl2) + G0(p2, m2a, m2b, scl2);
 }
 
 /// Derivative of B0(p^2,m1^2,m2^2,Q^2) w.r.t. p^2
-std::complex<double> D1B0(double p2, double m2a, double m2b) PVATTR;
+std::complex<double> D1B0(double p2, double m2a, double m2b) PVATTR_LOCKED;
 std::complex<double> D1B0(std::complex<double> p2, std::complex<double> m2a,
-                          std::complex<double> m2b) PVATTR;
+                          std::complex<double> m2b) PVATTR_LOCKED;
 
 /// Derivative of F0(p^2,m1^2,m2^2,Q^2) w.r.t. p^2
-template<class T> std::complex<double> D1F0(T, T, T, double) PVATTR;
-template<class T> std::complex<double> D1F0(T p2, T m2a, T m2b, double scl2) noexcept
+template<class T> std::complex<double> D1F0(T, T, T, double) PVATTR_LOCKED;
+template<class T> std::complex<double> D1F0(T p2, T m2a, T m2b, double scl2)
 {
     return - (2.0*p2 + 2.0*m2a - m2b) * D1B0(p2, m2a, m2b)
        - 2.0 * B0(p2, m2a, m2b, scl2);
 }
 
 /// Derivative of G0(p^2,m1^2,m2^2,Q^2) w.r.t. p^2
-template<class T> std::complex<double> D1G0(T, T, T, double) PVATTR;
-template<class T> std::complex<double> D1G0(T p2, T m2a, T m2b, double scl2) noexcept
+template<class T> std::complex<double> D1G0(T, T, T, double) PVATTR_LOCKED;
+template<class T> std::complex<double> D1G0(T p2, T m2a, T m2b, double scl2)
 {
     return (p2 - m2a - m2b) * D1B0(p2, m2a, m2b)
        + B0(p2, m2a, m2b, scl2);
@@ -122,22 +156,23 @@ template<class T> std::complex<double> D1G0(T p2, T m2a, T m2b, double scl2) noe
 // the following are mainly for interfacing with loop function
 // implementations from softsusy since they come only with double
 // return type.  If LoopTools or FF is in use, they reduce simply to
-// A0(m2, scl2).real(), etc.
-double ReA0 (double m2, double scl2) PVATTR;
-double ReB0 (double p2, double m2a, double m2b, double scl2) PVATTR;
-double ReB1 (double p2, double m2a, double m2b, double scl2) PVATTR;
-double ReB00(double p2, double m2a, double m2b, double scl2) PVATTR;
-double ReB22(double p2, double m2a, double m2b, double scl2) PVATTR;
-double ReH0 (double p2, double m2a, double m2b, double scl2) PVATTR;
-double ReF0 (double p2, double m2a, double m2b, double scl2) PVATTR;
-double ReG0 (double p2, double m2a, double m2b, double scl2) PVATTR;
+// A0(m2, scl2).real(), etc.  ReA0, ReB0, ReB1 and ReB00 are cached if
+// enable_cache(true) has been called.
+double ReA0 (double m2, double scl2) PVATTR_CACHED;
+double ReB0 (double p2, double m2a, double m2b, double scl2) PVATTR_CACHED;
+double ReB1 (double p2, double m2a, double m2b, double scl2) PVATTR_CACHED;
+double ReB00(double p2, double m2a, double m2b, double scl2) PVATTR_CACHED;
+double ReB22(double p2, double m2a, double m2b, double scl2) PVATTR_CACHED;
+double ReH0 (double p2, double m2a, double m2b, double scl2) PVATTR_CACHED;
+double ReF0 (double p2, double m2a, double m2b, double scl2) PVATTR_CACHED;
+double ReG0 (double p2, double m2a, double m2b, double scl2) PVATTR_CACHED;
 
 /// Real part of derivative of B0(p^2,m1^2,m2^2,Q^2) w.r.t. p^2
-double ReD1B0(double p2, double m2a, double m2b) PVATTR;
+double ReD1B0(double p2, double m2a, double m2b) PVATTR_LOCKED;
 /// Real part of derivative of F0(p^2,m1^2,m2^2,Q^2) w.r.t. p^2
-double ReD1F0(double p2, double m2a, double m2b, double scl2) PVATTR;
+double ReD1F0(double p2, double m2a, double m2b, double scl2) PVATTR_LOCKED;
 /// Real part of derivative of G0(p^2,m1^2,m2^2,Q^2) w.r.t. p^2
-double ReD1G0(double p2, double m2a, double m2b, double scl2) PVATTR;
+double ReD1G0(double p2, double m2a, double m2b, double scl2) PVATTR_LOCKED;
 
 } // namespace passarino_veltman
 
@@ -0,0 +1,123 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+/**
+ * @file rg_trajectory.cpp
+ * @brief contains implementation of class RG_trajectory
+ */
+
+#include "rg_trajectory.hpp"
+#include "error.hpp"
+
+#include <algorithm>
+
+namespace flexiblesusy {
+
+/**
+ * Adds a node to the trajectory.
+ *
+ * @param x_ independent variable
+ * @param y_ parameters at x_
+ * @param dydx_ derivatives of the parameters at x_
+ * @param d2ydx2_ second derivatives of the parameters at x_
+ */
+void RG_trajectory::add(double x_, const Eigen::ArrayXd& y_,
+                        const Eigen::ArrayXd& dydx_, const Eigen::ArrayXd& d2ydx2_)
+{
+   x.push_back(x_);
+   y.push_back(y_);
+   dydx.push_back(dydx_);
+   d2ydx2.push_back(d2ydx2_);
+}
+
+void RG_trajectory::clear()
+{
+   x.clear();
+   y.clear();
+   dydx.clear();
+   d2ydx2.clear();
+   precision = 0.;
+   loops = 0;
+   thresholds = 0;
+   zero_threshold = 0.;
+}
+
+bool RG_trajectory::contains(double x_) const
+{
+   if (empty())
+      return false;
+
+   const auto minmax = std::minmax(x.front(), x.back());
+
+   return minmax.first <= x_ && x_ <= minmax.second;
+}
+
+void RG_trajectory::set_settings(double precision_, int loops_, int thresholds_,
+                                 double zero_threshold_)
+{
+   precision = precision_;
+   loops = loops_;
+   thresholds = thresholds_;
+   zero_threshold = zero_threshold_;
+}
+
+/**
+ * Interpolates the parameters at the given value of the independent
+ * variable using a quintic Hermite polynomial of the parameters and
+ * their first and second derivatives at the neighbouring nodes.
+ *
+ * @param x_ independent variable (must lie within the recorded interval)
+ *
+ * @return interpolated parameters
+ */
+Eigen::ArrayXd RG_trajectory::interpolate(double x_) const
+{
+   if (!contains(x_))
+      throw OutOfBoundsError("RG_trajectory::interpolate: value outside of recorded interval");
+
+   const bool increasing = x.front() <= x.back();
+
+   // index of the first node which is not before x_
+   const auto it = increasing
+      ? std::lower_bound(x.cbegin(), x.cend(), x_)
+      : std::lower_bound(x.cbegin(), x.cend(), x_, [] (double a, double b) { return a > b; });
+
+   const std::size_t k = std::max<std::size_t>(1, std::distance(x.cbegin(), it));
+
+   if (x_ == x[k])
+      return y[k];
+   if (x_ == x[k - 1])
+      return y[k - 1];
+
+   const double h = x[k] - x[k - 1];
+   const double t = (x_ - x[k - 1]) / h;
+   const double t2 = t*t, t3 = t2*t, t4 = t3*t, t5 = t4*t;
+
+   // quintic Hermite basis functions
+   const double h0 = 1 - 10*t3 + 15*t4 - 6*t5;
+   const double h1 = t - 6*t3 + 8*t4 - 3*t5;
+   const double h2 = 0.5*(t2 - 3*t3 + 3*t4 - t5);
+   const double h3 = 0.5*(t3 - 2*t4 + t5);
+   const double h4 = -4*t3 + 7*t4 - 3*t5;
+   const double h5 = 10*t3 - 15*t4 + 6*t5;
+
+   return h0 * y[k - 1] + h1 * h * dydx[k - 1] + h2 * h * h * d2ydx2[k - 1]
+      + h5 * y[k] + h4 * h * dydx[k] + h3 * h * h * d2ydx2[k];
+}
+
+} // namespace flexiblesusy
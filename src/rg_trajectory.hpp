@@ -0,0 +1,70 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef RG_TRAJECTORY_H
+#define RG_TRAJECTORY_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace flexiblesusy {
+
+/**
+ * @class RG_trajectory
+ * @brief continuous representation of an RG trajectory
+ *
+ * Stores the parameters and their derivatives at the accepted
+ * Runge-Kutta steps of an integration and interpolates between the
+ * steps with a quintic Hermite polynomial of the parameters and their
+ * first and second derivatives (dense output).  The independent
+ * variable is the logarithm of the renormalization scale.  The
+ * interpolation is exact at the stored nodes.
+ */
+class RG_trajectory {
+public:
+   /// add step (nodes must be added in monotonic order)
+   void add(double, const Eigen::ArrayXd&, const Eigen::ArrayXd&, const Eigen::ArrayXd&);
+   void clear();
+   bool empty() const { return x.size() < 2; }
+   /// returns true if given value lies within the recorded interval
+   bool contains(double) const;
+   /// interpolates the parameters at the given value
+   Eigen::ArrayXd interpolate(double) const;
+   std::size_t size() const { return x.size(); }
+
+   double get_precision() const { return precision; }
+   int get_loops() const { return loops; }
+   int get_thresholds() const { return thresholds; }
+   double get_zero_threshold() const { return zero_threshold; }
+   void set_settings(double precision_, int loops_, int thresholds_, double zero_threshold_);
+
+private:
+   std::vector<double> x{};              ///< independent variable (log of scale)
+   std::vector<Eigen::ArrayXd> y{};      ///< parameters
+   std::vector<Eigen::ArrayXd> dydx{};   ///< derivatives of the parameters
+   std::vector<Eigen::ArrayXd> d2ydx2{}; ///< second derivatives of the parameters
+   double precision{0.};      ///< precision of the integration
+   int loops{0};              ///< loop order of the beta functions
+   int thresholds{0};         ///< threshold correction loop order
+   double zero_threshold{0.}; ///< threshold for treating values as zero
+};
+
+} // namespace flexiblesusy
+
+#endif
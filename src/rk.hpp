@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <initializer_list>
 
 #include <Eigen/Core>
 
@@ -48,12 +49,51 @@ inline double sign(double a, double b) noexcept {
 }
 } // anonymous namespace
 
-/// A single step of Runge Kutta (5th order), input:
-/// y and dydx (derivative of y), x is independent variable. yout is value
-/// after step. derivs is a user-supplied function
+/**
+ * @class Rk_workspace
+ * @brief pre-allocated temporaries for the in-place Runge-Kutta routines
+ *
+ * The arrays are allocated once per integration, s.t. the steps of
+ * integrateOdesInPlace() do not allocate memory.
+ */
+template <typename ArrayType>
+struct Rk_workspace {
+   explicit Rk_workspace(Eigen::Index n)
+   {
+      for (ArrayType* a: {&y, &dydx, &yscal, &yout, &yerr, &ytemp,
+                          &ak2, &ak3, &ak4, &ak5, &ak6})
+         a->resize(n);
+   }
+
+   ArrayType y, dydx, yscal, yout, yerr, ytemp, ak2, ak3, ak4, ak5, ak6;
+};
+
+/// adapts derivatives of the form derivs(x, y) -> dydx to the form
+/// derivs(x, y, dydx)
+template <typename Derivs>
+struct Derivs_in_place_adapter {
+   Derivs& derivs;
+
+   template <typename ArrayType>
+   void operator()(double x, const ArrayType& y, ArrayType& dydx) {
+      dydx = derivs(x, y);
+   }
+};
+
+template <typename Derivs>
+Derivs_in_place_adapter<Derivs> make_derivs_in_place(Derivs& derivs)
+{
+   return Derivs_in_place_adapter<Derivs>{derivs};
+}
+
+/// A single step of Runge Kutta (5th order), as rungeKuttaStep(), but
+/// with the derivatives written into a pre-allocated array,
+/// derivs(x, y, dydx).  The arrays ytemp and ak2, ..., ak6 of the
+/// workspace are used as temporaries.
 template <typename ArrayType, typename Derivs>
-void rungeKuttaStep(const ArrayType& y, const ArrayType& dydx, double x,
-		    double h, ArrayType& yout, ArrayType& yerr, Derivs derivs)
+void rungeKuttaStepInPlace(const ArrayType& y, const ArrayType& dydx, double x,
+                           double h, ArrayType& yout, ArrayType& yerr,
+                           Derivs& derivs, Rk_workspace<ArrayType>& ws)
 {
    const double a2 = 0.2;
    const double a3 = 0.3;
@@ -85,45 +125,62 @@ void rungeKuttaStep(const ArrayType& y, const ArrayType& dydx, double x,
    const double dc4 = c4 - 13525.0 / 55296.0;
    const double dc6 = c6 - 0.25;
 
-   ArrayType ytemp = b21 * h * dydx + y;
-   const ArrayType ak2 = derivs(x + a2 * h, ytemp);
+   ArrayType& ytemp = ws.ytemp;
+   ArrayType& ak2 = ws.ak2;
+   ArrayType& ak3 = ws.ak3;
+   ArrayType& ak4 = ws.ak4;
+   ArrayType& ak5 = ws.ak5;
+   ArrayType& ak6 = ws.ak6;
+
+   ytemp = b21 * h * dydx + y;
+   derivs(x + a2 * h, ytemp, ak2);
 
    // Allowing piece-wise calculating of ytemp for speed reasons
    ytemp = y + h * (b31 * dydx + b32 * ak2);
-   const ArrayType ak3 = derivs(x + a3 * h, ytemp);
+   derivs(x + a3 * h, ytemp, ak3);
 
    ytemp = y + h * (b41 * dydx + b42 * ak2 + b43 * ak3);
-   const ArrayType ak4 = derivs(x+a4*h,ytemp);
+   derivs(x + a4 * h, ytemp, ak4);
 
    ytemp = y + h * (b51 * dydx + b52 * ak2 + b53 * ak3 + b54 * ak4);
-   const ArrayType ak5 = derivs(x + a5 * h, ytemp);
+   derivs(x + a5 * h, ytemp, ak5);
 
    ytemp = y + h * (b61 * dydx + b62 * ak2 + b63 * ak3 + b64 * ak4 + b65 * ak5);
-   const ArrayType ak6 = derivs(x + a6 * h, ytemp);
+   derivs(x + a6 * h, ytemp, ak6);
 
    yout = y + h * (c1 * dydx + c3 * ak3 + c4 * ak4 + c6 * ak6);
    yerr = h * (dc1 * dydx + dc3 * ak3 + dc4 * ak4 + dc5 * ak5 + dc6 * ak6);
 }
 
-/// organises the variable step-size for Runge-Kutta evolution
+/// A single step of Runge Kutta (5th order), input:
+/// y and dydx (derivative of y), x is independent variable. yout is value
+/// after step. derivs is a user-supplied function
 template <typename ArrayType, typename Derivs>
-double odeStepper(ArrayType& y, const ArrayType& dydx, double& x, double htry,
-                  double eps, const ArrayType& yscal, Derivs derivs,
-                  int& max_step_dir)
+void rungeKuttaStep(const ArrayType& y, const ArrayType& dydx, double x,
+		    double h, ArrayType& yout, ArrayType& yerr, Derivs derivs)
+{
+   Rk_workspace<ArrayType> ws(y.size());
+   auto derivs_in_place = make_derivs_in_place(derivs);
+   rungeKuttaStepInPlace(y, dydx, x, h, yout, yerr, derivs_in_place, ws);
+}
+
+/// organises the variable step-size for Runge-Kutta evolution, as
+/// odeStepper(), but without memory allocation
+template <typename ArrayType, typename Derivs>
+double odeStepperInPlace(ArrayType& y, const ArrayType& dydx, double& x, double htry,
+                         double eps, const ArrayType& yscal, Derivs& derivs,
+                         int& max_step_dir, Rk_workspace<ArrayType>& ws)
 {
    const double SAFETY = 0.9;
    const double PGROW = -0.2;
    const double PSHRNK = -0.25;
    const double ERRCON = 1.89e-4;
-   const int n = y.size();
    double errmax;
    double h = htry;
-   ArrayType yerr(n);
-   ArrayType ytemp(n);
 
    for (;;) {
-      rungeKuttaStep(y, dydx, x, h, ytemp, yerr, derivs);
-      errmax = (yerr / yscal).abs().maxCoeff(&max_step_dir);
+      rungeKuttaStepInPlace(y, dydx, x, h, ws.yout, ws.yerr, derivs, ws);
+      errmax = (ws.yerr / yscal).abs().maxCoeff(&max_step_dir);
       errmax  /= eps;
       if (!std::isfinite(errmax)) {
 #ifdef ENABLE_VERBOSE
@@ -150,35 +207,85 @@ double odeStepper(ArrayType& y, const ArrayType& dydx, double& x, double htry,
       }
    }
    x += h;
-   y = ytemp;
+   y = ws.yout;
 
    return errmax > ERRCON ? SAFETY * h * std::pow(errmax,PGROW) : 5.0 * h;
 }
 
-/// Organises integration of 1st order system of ODEs
-template <typename ArrayType, typename Derivs,
-          typename Stepper = decltype(runge_kutta::odeStepper<ArrayType,Derivs>)>
-void integrateOdes(ArrayType& ystart, double from, double to, double eps,
-                   double h1, double hmin, Derivs derivs,
-                   Stepper rkqs = runge_kutta::odeStepper<ArrayType,Derivs>, int max_steps = 400)
+/// organises the variable step-size for Runge-Kutta evolution.  The
+/// temporaries are allocated in each call, see Ode_stepper.
+template <typename ArrayType, typename Derivs>
+double odeStepper(ArrayType& y, const ArrayType& dydx, double& x, double htry,
+                  double eps, const ArrayType& yscal, Derivs derivs,
+                  int& max_step_dir)
+{
+   Rk_workspace<ArrayType> ws(y.size());
+   auto derivs_in_place = make_derivs_in_place(derivs);
+   return odeStepperInPlace(y, dydx, x, htry, eps, yscal, derivs_in_place,
+                            max_step_dir, ws);
+}
+
+/**
+ * @class Ode_stepper
+ * @brief odeStepper(), which re-uses its temporaries in each step
+ *
+ * The workspace is allocated once at construction, s.t. one object
+ * can be used for all steps of an integration with derivatives of the
+ * form derivs(x, y) -> dydx.
+ */
+template <typename ArrayType>
+class Ode_stepper {
+public:
+   explicit Ode_stepper(Eigen::Index n) : ws(n) {}
+
+   template <typename Derivs>
+   double operator()(ArrayType& y, const ArrayType& dydx, double& x, double htry,
+                     double eps, const ArrayType& yscal, Derivs& derivs,
+                     int& max_step_dir)
+   {
+      auto derivs_in_place = make_derivs_in_place(derivs);
+      return odeStepperInPlace(y, dydx, x, htry, eps, yscal, derivs_in_place,
+                               max_step_dir, ws);
+   }
+
+private:
+   Rk_workspace<ArrayType> ws;
+};
+
+/// observer which ignores the integration steps
+struct No_step_observer {
+   template <typename ArrayType>
+   void operator()(double, const ArrayType&, const ArrayType&) const {}
+};
+
+namespace detail {
+
+/// Integration loop of integrateOdes() and integrateOdesInPlace().
+/// The derivatives are calculated by derivs(x, y, dydx) and the steps
+/// are done by step(y, dydx, x, h, yscal, max_step_dir), which
+/// returns the next step size.
+template <typename ArrayType, typename Derivs, typename Step, typename Observer>
+void integrate_odes(ArrayType& ystart, double from, double to,
+                    double h1, double hmin, Derivs& derivs, Step& step,
+                    int max_steps, Observer& observer,
+                    ArrayType& y, ArrayType& dydx, ArrayType& yscal)
 {
-   const int nvar = ystart.size();
    const double TINY = 1.0e-16;
    double x = from;
    double h = sign(h1, to - from);
-   ArrayType yscal(nvar);
-   ArrayType y(ystart);
-   ArrayType dydx;
    int max_step_dir;
 
+   y = ystart;
+
    for (int nstp = 0; nstp < max_steps; ++nstp) {
-      dydx = derivs(x, y);
+      derivs(x, y, dydx);
+      observer(x, y, dydx);
       yscal = y.abs() + (dydx * h).abs() + TINY;
       if ((x + h - to) * (x + h - from) > 0.0) {
          h = to - x;
       }
 
-      const double hnext = rkqs(y, dydx, x, h, eps, yscal, derivs, max_step_dir);
+      const double hnext = step(y, dydx, x, h, yscal, max_step_dir);
 
       if ((x - to) * (to - from) >= 0.0) {
          ystart = y;
@@ -196,7 +303,7 @@ void integrateOdes(ArrayType& ystart, double from, double to, double eps,
    ERROR("Bailed out of rk.cpp:too many steps in integrateOdes\n"
          "********** Q = " << std::exp(x) << " *********");
    ERROR("max step in direction of " << max_step_dir);
-   for (int i = 0; i < nvar; i++)
+   for (int i = 0; i < y.size(); i++)
       ERROR("y(" << i << ") = " << y(i) << " dydx(" << i <<
             ") = " << dydx(i));
 #endif
@@ -204,6 +311,59 @@ void integrateOdes(ArrayType& ystart, double from, double to, double eps,
    throw NonPerturbativeRunningError(std::exp(x), max_step_dir, y(max_step_dir));
 }
 
+} // namespace detail
+
+/// Organises integration of 1st order system of ODEs with the given
+/// stepper rkqs(y, dydx, x, h, eps, yscal, derivs, max_step_dir)
+template <typename ArrayType, typename Derivs,
+          typename Stepper = decltype(runge_kutta::odeStepper<ArrayType,Derivs>)>
+void integrateOdes(ArrayType& ystart, double from, double to, double eps,
+                   double h1, double hmin, Derivs derivs,
+                   Stepper rkqs, int max_steps = 400)
+{
+   ArrayType y(ystart), dydx(ystart), yscal(ystart);
+   No_step_observer observer;
+   auto derivs_in_place = make_derivs_in_place(derivs);
+   auto step = [&] (ArrayType& y, const ArrayType& dydx, double& x, double h,
+                    const ArrayType& yscal, int& max_step_dir) {
+      return rkqs(y, dydx, x, h, eps, yscal, derivs, max_step_dir);
+   };
+
+   detail::integrate_odes(ystart, from, to, h1, hmin, derivs_in_place, step,
+                          max_steps, observer, y, dydx, yscal);
+}
+
+/// Organises integration of 1st order system of ODEs with an
+/// Ode_stepper, whose temporaries are allocated once per integration
+template <typename ArrayType, typename Derivs>
+void integrateOdes(ArrayType& ystart, double from, double to, double eps,
+                   double h1, double hmin, Derivs derivs)
+{
+   Ode_stepper<ArrayType> rkqs(ystart.size());
+   integrateOdes(ystart, from, to, eps, h1, hmin, derivs, std::ref(rkqs));
+}
+
+/// Organises integration of 1st order system of ODEs, as
+/// integrateOdes(), but with derivatives written into a
+/// pre-allocated array, derivs(x, y, dydx).  Memory is allocated only
+/// once per integration.  The observer is called at the beginning of
+/// each accepted step as observer(x, y, dydx).
+template <typename ArrayType, typename Derivs, typename Observer = No_step_observer>
+void integrateOdesInPlace(ArrayType& ystart, double from, double to, double eps,
+                          double h1, double hmin, Derivs derivs, int max_steps = 400,
+                          Observer observer = Observer())
+{
+   Rk_workspace<ArrayType> ws(ystart.size());
+   auto step = [&] (ArrayType& y, const ArrayType& dydx, double& x, double h,
+                    const ArrayType& yscal, int& max_step_dir) {
+      return odeStepperInPlace(y, dydx, x, h, eps, yscal, derivs,
+                               max_step_dir, ws);
+   };
+
+   detail::integrate_odes(ystart, from, to, h1, hmin, derivs, step,
+                          max_steps, observer, ws.y, ws.dydx, ws.yscal);
+}
+
 } // namespace runge_kutta
 
 } // namespace flexiblesusy
@@ -90,6 +90,39 @@ void RKF_integrator::operator()(double start, double end,
       stepper, derivatives, pars, start, end, guess, RKF_observer());
 }
 
+/**
+ * The vector of the initial values of the parameters is
+ * updated so that after calling this function, this vector contains
+ * the updated values of the parameters at the end-point of the
+ * integration.  The derivatives are written directly into the
+ * state derivative of the odeint stepper.
+ *
+ * @param[in] start initial value of the independent variable
+ * @param[in] end final value of the independent variable
+ * @param[inout] pars initial values of the parameters
+ * @param[in] derivs function writing the derivatives into its last argument
+ * @param[in] tol desired accuracy to use in integration step
+ */
+void RKF_integrator::operator()(double start, double end,
+                                Eigen::ArrayXd& pars, const Derivs_in_place& derivs,
+                                double tol) const
+{
+   using state_type = Eigen::ArrayXd;
+   using stepper_type = boost::numeric::odeint::runge_kutta_fehlberg78<
+      state_type, double, state_type, double,
+      boost::numeric::odeint::vector_space_algebra
+      >;
+
+   const double guess = (end - start) * 0.1; // first step size
+   const auto derivatives = [&derivs] (const state_type& y, state_type& dydt, double t) -> void {
+      derivs(t, y, dydt);
+   };
+
+   const auto stepper = boost::numeric::odeint::make_controlled(tol, tol, stepper_type());
+   boost::numeric::odeint::integrate_adaptive(
+      stepper, derivatives, pars, start, end, guess, RKF_observer());
+}
+
 void RKF_integrator::RKF_observer::operator()(const Eigen::ArrayXd& state, double t) const
 {
    if (!IsFinite(state)) {
@@ -137,6 +170,12 @@ void RKF_integrator::operator()(double, double, Eigen::ArrayXd&, const Derivs&,
    throw DisabledOdeintError("Cannot call operator(), because odeint support is disabled.");
 }
 
+void RKF_integrator::operator()(double, double, Eigen::ArrayXd&, const Derivs_in_place&,
+                                double) const
+{
+   throw DisabledOdeintError("Cannot call operator(), because odeint support is disabled.");
+}
+
 } // namespace runge_kutta
 
 } // namespace flexiblesusy
@@ -25,6 +25,7 @@
 #define RKF_INTEGRATOR_H
 
 #include "error.hpp"
+#include <functional>
 #include <string>
 
 #include <Eigen/Core>
@@ -43,10 +44,16 @@ namespace runge_kutta {
 class RKF_integrator {
 public:
    using Derivs = std::function<Eigen::ArrayXd(double, const Eigen::ArrayXd&)>;
+   /// function writing the derivatives into its last argument
+   using Derivs_in_place = std::function<void(double, const Eigen::ArrayXd&, Eigen::ArrayXd&)>;
 
    /// Integrates the system over an interval
    void operator()(double start, double end, Eigen::ArrayXd& pars,
                    const Derivs& derivs, double tol) const;
+   /// Integrates the system over an interval without allocating
+   /// memory for the derivatives
+   void operator()(double start, double end, Eigen::ArrayXd& pars,
+                   const Derivs_in_place& derivs, double tol) const;
 private:
    class DisabledOdeintError : Error {
    public:
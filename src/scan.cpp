@@ -81,4 +81,34 @@ std::vector<double> float_range_log(double start, double stop,
    return result;
 }
 
+/**
+ * Returns the points of the 2-dimensional grid xs times ys, ordered
+ * along a serpentine path: the x values are traversed in alternating
+ * direction for consecutive y values.  Consecutive points of the path
+ * are therefore always neighbours on the grid, as needed by the
+ * Continuation driver.
+ *
+ * @param xs grid values of the first parameter
+ * @param ys grid values of the second parameter
+ *
+ * @return vector of grid points
+ */
+std::vector<Eigen::VectorXd> serpentine_grid(const std::vector<double>& xs,
+                                             const std::vector<double>& ys)
+{
+   std::vector<Eigen::VectorXd> result;
+   result.reserve(xs.size() * ys.size());
+
+   for (std::size_t i = 0; i < ys.size(); ++i) {
+      for (std::size_t k = 0; k < xs.size(); ++k) {
+         const std::size_t kk = i % 2 == 0 ? k : xs.size() - 1 - k;
+         Eigen::VectorXd point(2);
+         point << xs[kk], ys[i];
+         result.push_back(point);
+      }
+   }
+
+   return result;
+}
+
 } // namespace flexiblesusy
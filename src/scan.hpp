@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <vector>
+#include <Eigen/Core>
 
 namespace flexiblesusy {
 
@@ -32,6 +33,10 @@ std::vector<double> float_range(double start, double stop,
 std::vector<double> float_range_log(double start, double stop,
                                     std::size_t number_of_steps);
 
+/// returns the points of a 2-dimensional grid along a serpentine path
+std::vector<Eigen::VectorXd> serpentine_grid(const std::vector<double>& xs,
+                                             const std::vector<double>& ys);
+
 } // namespace flexiblesusy
 
 #endif
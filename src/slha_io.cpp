@@ -32,9 +32,84 @@ namespace flexiblesusy {
 void SLHA_io::clear()
 {
    data.clear();
+   reader.clear();
+   data_outdated = false;
+   reader_outdated = false;
    modsel.clear();
 }
 
+/**
+ * Returns the SLHA data.  After reading SLHA input, the data are
+ * parsed by SLHAea only when they are needed for the first time.
+ */
+const SLHAea::Coll& SLHA_io::get_data() const
+{
+#ifdef ENABLE_THREADS
+   std::lock_guard<std::mutex> lock(update_mutex.mutex);
+#endif
+   if (data_outdated) {
+      data.str(reader.get_source());
+      data_outdated = false;
+   }
+   return data;
+}
+
+/**
+ * Returns the SLHA data for modification.  The index of the reader
+ * is updated before the next read access.
+ */
+SLHAea::Coll& SLHA_io::modify_data()
+{
+   get_data();
+   reader_outdated = true;
+   return data;
+}
+
+/**
+ * Replaces the SLHA data.
+ *
+ * @param data_ SLHA data
+ */
+void SLHA_io::set_data(const SLHAea::Coll& data_)
+{
+   data = data_;
+   data_outdated = false;
+   update_reader();
+}
+
+/**
+ * Returns the reader for the SLHA data, which is updated from the
+ * SLHAea data if they have been modified.
+ */
+const SLHA_reader& SLHA_io::get_reader() const
+{
+#ifdef ENABLE_THREADS
+   std::lock_guard<std::mutex> lock(update_mutex.mutex);
+#endif
+   if (reader_outdated)
+      update_reader();
+   return reader;
+}
+
+/// re-indexes the SLHAea data, by passing their fields to the reader
+void SLHA_io::update_reader() const
+{
+   std::string str;
+
+   for (const auto& block: data) {
+      for (const auto& line: block) {
+         for (std::size_t i = 0; i < line.size(); i++) {
+            if (i > 0) str += ' ';
+            str += line[i];
+         }
+         str += '\n';
+      }
+   }
+
+   reader.read_from_string(std::move(str));
+   reader_outdated = false;
+}
+
 void SLHA_io::convert_symmetric_fermion_mixings_to_slha(double&,
                                                         Eigen::Matrix<double, 1, 1>&)
 {
@@ -81,14 +156,7 @@ void SLHA_io::convert_symmetric_fermion_mixings_to_hk(double& m,
 
 bool SLHA_io::block_exists(const std::string& block_name) const
 {
-   return data.find(block_name) != data.cend();
-}
-
-std::string SLHA_io::to_lower(const std::string& str)
-{
-   std::string lower(str.size(), ' ');
-   std::transform(str.begin(), str.end(), lower.begin(), ::tolower);
-   return lower;
+   return get_reader().block_exists(block_name);
 }
 
 /**
@@ -113,12 +181,11 @@ void SLHA_io::read_from_source(const std::string& source)
  */
 void SLHA_io::read_from_file(const std::string& file_name)
 {
-   std::ifstream ifs(file_name);
-   if (ifs.good()) {
-      read_from_stream(ifs);
-   } else {
-      throw ReadError(R"(cannot read SLHA file: ")" + file_name + R"(")");
-   }
+   reader.read_from_file(file_name);
+   data.clear();
+   data_outdated = true;
+   reader_outdated = false;
+   read_modsel();
 }
 
 /**
@@ -127,8 +194,10 @@ void SLHA_io::read_from_file(const std::string& file_name)
  */
 void SLHA_io::read_from_stream(std::istream& istr)
 {
+   reader.read_from_stream(istr);
    data.clear();
-   data.read(istr);
+   data_outdated = true;
+   reader_outdated = false;
    read_modsel();
 }
 
@@ -222,31 +291,7 @@ void SLHA_io::fill(Spectrum_generator_settings& settings) const
  */
 double SLHA_io::read_block(const std::string& block_name, const Tuple_processor& processor) const
 {
-   auto block = data.find(data.cbegin(), data.cend(), block_name);
-   double scale = 0.;
-
-   while (block != data.cend()) {
-      for (const auto& line: *block) {
-         if (!line.is_data_line()) {
-            // read scale from block definition
-            if (line.size() > 3 &&
-                to_lower(line[0]) == "block" && line[2] == "Q=")
-               scale = convert_to<double>(line[3]);
-            continue;
-         }
-
-         if (line.size() >= 2) {
-            const auto key = convert_to<int>(line[0]);
-            const auto value = convert_to<double>(line[1]);
-            processor(key, value);
-         }
-      }
-
-      ++block;
-      block = data.find(block, data.cend(), block_name);
-   }
-
-   return scale;
+   return get_reader().read_block(block_name, processor);
 }
 
 /**
@@ -259,48 +304,12 @@ double SLHA_io::read_block(const std::string& block_name, const Tuple_processor&
  */
 double SLHA_io::read_block(const std::string& block_name, double& entry) const
 {
-   auto block = data.find(data.cbegin(), data.cend(), block_name);
-   double scale = 0.;
-
-   while (block != data.cend()) {
-      for (const auto& line: *block) {
-         if (!line.is_data_line()) {
-            // read scale from block definition
-            if (line.size() > 3 &&
-                to_lower(line[0]) == "block" && line[2] == "Q=")
-               scale = convert_to<double>(line[3]);
-            continue;
-         }
-
-         if (line.size() >= 1)
-            entry = convert_to<double>(line[0]);
-      }
-
-      ++block;
-      block = data.find(block, data.cend(), block_name);
-   }
-
-   return scale;
+   return get_reader().read_block(block_name, entry);
 }
 
 double SLHA_io::read_entry(const std::string& block_name, int key) const
 {
-   auto block = data.find(data.cbegin(), data.cend(), block_name);
-   double entry = 0.;
-   const SLHAea::Block::key_type keys(1, ToString(key));
-   SLHAea::Block::const_iterator line;
-
-   while (block != data.cend()) {
-      line = block->find(keys);
-
-      if (line != block->end() && line->is_data_line() && line->size() > 1)
-         entry = convert_to<double>(line->at(1));
-
-      ++block;
-      block = data.find(block, data.cend(), block_name);
-   }
-
-   return entry;
+   return get_reader().read_entry(block_name, key);
 }
 
 /**
@@ -312,32 +321,19 @@ double SLHA_io::read_entry(const std::string& block_name, int key) const
  */
 double SLHA_io::read_scale(const std::string& block_name) const
 {
-   if (!block_exists(block_name))
-      return 0.;
-
-   double scale = 0.;
-
-   for (const auto& line: data.at(block_name)) {
-      if (!line.is_data_line()) {
-         if (line.size() > 3 &&
-             to_lower(line[0]) == "block" && line[2] == "Q=")
-            scale = convert_to<double>(line[3]);
-         break;
-      }
-   }
-
-   return scale;
+   return get_reader().read_scale(block_name);
 }
 
 void SLHA_io::set_block(const std::ostringstream& lines, Position position)
 {
    SLHAea::Block block;
    block.str(lines.str());
-   data.erase(block.name());
+   auto& coll = modify_data();
+   coll.erase(block.name());
    if (position == front)
-      data.push_front(block);
+      coll.push_front(block);
    else
-      data.push_back(block);
+      coll.push_back(block);
 }
 
 void SLHA_io::set_block(const std::string& lines, Position position)
@@ -398,6 +394,26 @@ void SLHA_io::set_physical_input(const Physical_input& input)
    set_block(ss);
 }
 
+/**
+ * Writes the recorded timings to the block FlexibleSUSYProfile.  Each
+ * entry contains the number of calls and the accumulated wall time
+ * (in seconds) of an instrumented code section.
+ *
+ * @param report recorded timings
+ */
+void SLHA_io::set_profile(const profiling::Report& report)
+{
+   std::ostringstream ss;
+   ss << "Block FlexibleSUSYProfile\n";
+
+   int i = 0;
+   for (const auto& r: report) {
+      ss << FORMAT_PROFILE(i++, r.second.calls, r.second.time, r.first);
+   }
+
+   set_block(ss);
+}
+
 void SLHA_io::set_settings(const Spectrum_generator_settings& settings)
 {
    std::ostringstream ss;
@@ -446,7 +462,7 @@ void SLHA_io::write_to_file(const std::string& file_name) const
 void SLHA_io::write_to_stream(std::ostream& ostr) const
 {
    if (ostr.good())
-      ostr << data;
+      ostr << get_data();
    else
       ERROR("cannot write SLHA file");
 }
@@ -19,19 +19,26 @@
 #ifndef SLHA_IO_H
 #define SLHA_IO_H
 
+#include "config.h"
+
 #include <string>
 #include <sstream>
 #include <iosfwd>
 #include <vector>
+#ifdef ENABLE_THREADS
+#  include <mutex>
+#endif
 #include <Eigen/Core>
 #include <boost/format.hpp>
 #include <boost/function.hpp>
 #include "slhaea.h"
+#include "slha_reader.hpp"
 #include "logger.hpp"
 #include "error.hpp"
 #include "wrappers.hpp"
 #include "numerics2.hpp"
 #include "pmns.hpp"
+#include "profiling.hpp"
 
 namespace softsusy {
    class QedQcd;
@@ -59,6 +66,8 @@ namespace flexiblesusy {
       const boost::format single_element_formatter(" %5d   %16.8E   # %s\n");
       /// SLHA line formatter for the SPINFO block entries
       const boost::format spinfo_formatter(" %5d   %s\n");
+      /// SLHA line formatter for the FlexibleSUSYProfile block entries
+      const boost::format profile_formatter(" %5d   %10d   %16.8E   # %s\n");
    } // namespace
 
 #define FORMAT_MASS(pdg,mass,name)                                      \
@@ -75,6 +84,8 @@ namespace flexiblesusy {
    boost::format(spinfo_formatter) % (n) % (str)
 #define FORMAT_RANK_THREE_TENSOR(i,j,k,entry,name)                      \
    boost::format(tensor_formatter) % (i) % (j) % (k) % (entry) % (name)
+#define FORMAT_PROFILE(n,calls,time,name)                               \
+   boost::format(profile_formatter) % (n) % (calls) % (time) % (name)
 
 /**
  * @class SLHA_io
@@ -119,6 +130,14 @@ void read_file() {
    }
 }
  * \endcode
+ *
+ * Thread safety: The const member functions (read_block(),
+ * read_entry(), get_data(), write_to_stream(), ...) may lazily
+ * re-build the SLHA data or the reader index after a modification.
+ * This update is guarded by a mutex, s.t. the const member functions
+ * of the same %SLHA_io object may be called from several threads
+ * concurrently.  Calls of non-const member functions require
+ * external synchronisation.
  */
 class SLHA_io {
 public:
@@ -144,7 +163,7 @@ public:
    void fill(Spectrum_generator_settings&) const;
    void fill(Physical_input&) const;
    const Modsel& get_modsel() const { return modsel; }
-   const SLHAea::Coll& get_data() const { return data; }
+   const SLHAea::Coll& get_data() const;
    void read_from_file(const std::string&);
    void read_from_source(const std::string&);
    void read_from_stream(std::istream&);
@@ -156,7 +175,7 @@ public:
    double read_scale(const std::string&) const;
 
    // writing functions
-   void set_data(const SLHAea::Coll& data_) { data = data_; }
+   void set_data(const SLHAea::Coll&);
    void set_block(const std::ostringstream&, Position position = back);
    void set_block(const std::string&, Position position = back);
    void set_blocks(const std::vector<std::string>&, Position position = back);
@@ -175,6 +194,7 @@ public:
    void set_block_imag(const std::string&, const Eigen::MatrixBase<Derived>&, const std::string&, double scale = 0.);
    void set_modsel(const Modsel&);
    void set_physical_input(const Physical_input&);
+   void set_profile(const profiling::Report&);
    void set_settings(const Spectrum_generator_settings&);
    void set_sminputs(const softsusy::QedQcd&);
    void write_to_file(const std::string&) const;
@@ -209,11 +229,26 @@ public:
                                                        Eigen::Matrix<std::complex<double>, 1, 1>&);
 
 private:
-   SLHAea::Coll data{};        ///< SHLA data
+#ifdef ENABLE_THREADS
+   /// mutex, which is not copied together with the SLHA data
+   struct Update_mutex {
+      Update_mutex() = default;
+      Update_mutex(const Update_mutex&) {}
+      Update_mutex& operator=(const Update_mutex&) { return *this; }
+      std::mutex mutex{};
+   };
+#endif
+
+   // The following members are updated lazily in const member
+   // functions while holding update_mutex (see class documentation).
+   mutable SLHAea::Coll data{};   ///< SHLA data
+   mutable SLHA_reader reader{};  ///< index of the SLHA data for reading
+   mutable bool data_outdated{false};   ///< data must be parsed from reader
+   mutable bool reader_outdated{false}; ///< reader must be updated from data
+#ifdef ENABLE_THREADS
+   mutable Update_mutex update_mutex{}; ///< guards the lazy updates
+#endif
    Modsel modsel{};            ///< data from block MODSEL
-   template <class Scalar>
-   static Scalar convert_to(const std::string&); ///< convert string
-   static std::string to_lower(const std::string&); ///< string to lower case
    static void process_sminputs_tuple(softsusy::QedQcd&, int, double);
    static void process_modsel_tuple(Modsel&, int, double);
    static void process_vckmin_tuple(CKM_wolfenstein&, int, double);
@@ -221,10 +256,9 @@ private:
    static void process_flexiblesusy_tuple(Spectrum_generator_settings&, int, double);
    static void process_flexiblesusyinput_tuple(Physical_input&, int, double);
    void read_modsel();
-   template <class Derived>
-   double read_matrix(const std::string&, Eigen::MatrixBase<Derived>&) const;
-   template <class Derived>
-   double read_vector(const std::string&, Eigen::MatrixBase<Derived>&) const;
+   SLHAea::Coll& modify_data();
+   const SLHA_reader& get_reader() const;
+   void update_reader() const;
 };
 
 template<class S>
@@ -235,109 +269,6 @@ struct Set_spectrum {
    void operator()(const T& model) const { slha_io->set_spectrum(model); }
 };
 
-template <class Scalar>
-Scalar SLHA_io::convert_to(const std::string& str)
-{
-   Scalar value;
-   try {
-      value = SLHAea::to<Scalar>(str);
-   }  catch (const boost::bad_lexical_cast& error) {
-      const std::string msg(R"(cannot convert string ")" + str + R"(" to )"
-                            + typeid(Scalar).name());
-      throw ReadError(msg);
-   }
-   return value;
-}
-
-/**
- * Fills a matrix from a SLHA block
- *
- * @param block_name block name
- * @param matrix matrix to be filled
- *
- * @return scale (or 0 if no scale is defined)
- */
-template <class Derived>
-double SLHA_io::read_matrix(const std::string& block_name, Eigen::MatrixBase<Derived>& matrix) const
-{
-   if (matrix.cols() <= 1) throw SetupError("Matrix has less than 2 columns");
-
-   auto block = data.find(data.cbegin(), data.cend(), block_name);
-
-   const int cols = matrix.cols(), rows = matrix.rows();
-   double scale = 0.;
-
-   while (block != data.cend()) {
-      for (const auto& line: *block) {
-         if (!line.is_data_line()) {
-            // read scale from block definition
-            if (line.size() > 3 &&
-                to_lower(line[0]) == "block" && line[2] == "Q=")
-               scale = convert_to<double>(line[3]);
-            continue;
-         }
-
-         if (line.size() >= 3) {
-            const int i = convert_to<int>(line[0]) - 1;
-            const int k = convert_to<int>(line[1]) - 1;
-            if (0 <= i && i < rows && 0 <= k && k < cols) {
-               const double value = convert_to<double>(line[2]);
-               matrix(i,k) = value;
-            }
-         }
-      }
-
-      ++block;
-      block = data.find(block, data.cend(), block_name);
-   }
-
-   return scale;
-}
-
-/**
- * Fills a vector from a SLHA block
- *
- * @param block_name block name
- * @param vector vector to be filled
- *
- * @return scale (or 0 if no scale is defined)
- */
-template <class Derived>
-double SLHA_io::read_vector(const std::string& block_name, Eigen::MatrixBase<Derived>& vector) const
-{
-   if (vector.cols() != 1) throw SetupError("Vector has more than 1 column");
-
-   auto block = data.find(data.cbegin(), data.cend(), block_name);
-
-   const int rows = vector.rows();
-   double scale = 0.;
-
-   while (block != data.cend()) {
-      for (const auto& line: *block) {
-         if (!line.is_data_line()) {
-            // read scale from block definition
-            if (line.size() > 3 &&
-                to_lower(line[0]) == "block" && line[2] == "Q=")
-               scale = convert_to<double>(line[3]);
-            continue;
-         }
-
-         if (line.size() >= 2) {
-            const int i = convert_to<int>(line[0]) - 1;
-            if (0 <= i && i < rows) {
-               const double value = convert_to<double>(line[1]);
-               vector(i,0) = value;
-            }
-         }
-      }
-
-      ++block;
-      block = data.find(block, data.cend(), block_name);
-   }
-
-   return scale;
-}
-
 /**
  * Fills a matrix or vector from a SLHA block
  *
@@ -349,9 +280,7 @@ double SLHA_io::read_vector(const std::string& block_name, Eigen::MatrixBase<Der
 template <class Derived>
 double SLHA_io::read_block(const std::string& block_name, Eigen::MatrixBase<Derived>& dense) const
 {
-   return dense.cols() == 1
-      ? read_vector(block_name, dense)
-      : read_matrix(block_name, dense);
+   return get_reader().read_block(block_name, dense);
 }
 
 template<class Scalar, int NRows>
@@ -0,0 +1,424 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#include "slha_reader.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <typeinfo>
+#include <utility>
+
+#include <locale.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+
+/**
+ * @file slha_reader.cpp
+ * @brief contains the implementation of the fast SLHA reader
+ */
+
+namespace flexiblesusy {
+
+namespace {
+
+bool is_whitespace(char c)
+{
+   return c == ' ' || c == '\t' || c == '\v' || c == '\f' || c == '\r';
+}
+
+bool iequals(const char* a, std::size_t length, const char* b)
+{
+   for (std::size_t i = 0; i < length; i++) {
+      if (b[i] == '\0' ||
+          std::toupper(static_cast<unsigned char>(a[i])) !=
+          std::toupper(static_cast<unsigned char>(b[i])))
+         return false;
+   }
+   return b[length] == '\0';
+}
+
+std::string to_upper(const char* str, std::size_t length)
+{
+   std::string upper(str, length);
+   for (auto& c: upper)
+      c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+   return upper;
+}
+
+template <class Scalar>
+void throw_conversion_error(const char* str, std::size_t length)
+{
+   throw ReadError(R"(cannot convert string ")" + std::string(str, length)
+                   + R"(" to )" + typeid(Scalar).name());
+}
+
+/// returns the classic "C" locale for the conversion functions
+locale_t c_locale()
+{
+   static const locale_t locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+   return locale;
+}
+
+/**
+ * Converts a string to a number, independent of the global C and C++
+ * locales.  The string must not contain any other characters and
+ * must be followed by a character which cannot be part of a number
+ * (whitespace, '#' or '\0'), which holds for all fields of the input
+ * buffer.  Therefore, the number is converted in place, without
+ * copying the string.  As std::strtod(), floating point numbers may
+ * be "nan", "nan(...)", "inf" or "infinity" in any case and with an
+ * optional sign.
+ *
+ * @param str pointer to the first character
+ * @param length number of characters
+ *
+ * @return number
+ */
+template <class Scalar>
+Scalar to_number(const char* str, std::size_t length);
+
+template <>
+double to_number(const char* str, std::size_t length)
+{
+   char* end = nullptr;
+   errno = 0;
+   const double value = strtod_l(str, &end, c_locale());
+
+   if (length == 0 || end != str + length ||
+       (errno == ERANGE && std::abs(value) == HUGE_VAL))
+      throw_conversion_error<double>(str, length);
+
+   return value;
+}
+
+template <>
+int to_number(const char* str, std::size_t length)
+{
+   char* end = nullptr;
+   errno = 0;
+   const long value = strtol_l(str, &end, 10, c_locale());
+
+   if (length == 0 || end != str + length || errno == ERANGE ||
+       value < std::numeric_limits<int>::min() ||
+       value > std::numeric_limits<int>::max())
+      throw_conversion_error<int>(str, length);
+
+   return static_cast<int>(value);
+}
+
+} // anonymous namespace
+
+bool SLHA_reader::Line::equals(std::size_t i, const char* str) const
+{
+   const Field& f = reader->fields[first_field + i];
+   return std::strlen(str) == f.length &&
+      std::memcmp(reader->source.data() + f.pos, str, f.length) == 0;
+}
+
+bool SLHA_reader::Line::iequals(std::size_t i, const char* str) const
+{
+   const Field& f = reader->fields[first_field + i];
+   return flexiblesusy::iequals(reader->source.data() + f.pos, f.length, str);
+}
+
+std::string SLHA_reader::Line::field(std::size_t i) const
+{
+   const Field& f = reader->fields[first_field + i];
+   return reader->source.substr(f.pos, f.length);
+}
+
+/**
+ * Converts field i to an integer.  The field must not contain any
+ * other characters.
+ *
+ * @param i field index
+ *
+ * @return integer value of the field
+ */
+int SLHA_reader::Line::to_int(std::size_t i) const
+{
+   const Field& f = reader->fields[first_field + i];
+   return to_number<int>(reader->source.data() + f.pos, f.length);
+}
+
+/**
+ * Converts field i to a double.  The field must not contain any
+ * other characters.
+ *
+ * @param i field index
+ *
+ * @return floating point value of the field
+ */
+double SLHA_reader::Line::to_double(std::size_t i) const
+{
+   const Field& f = reader->fields[first_field + i];
+   return to_number<double>(reader->source.data() + f.pos, f.length);
+}
+
+void SLHA_reader::clear()
+{
+   source.clear();
+   fields.clear();
+   lines.clear();
+   blocks.clear();
+   index.clear();
+}
+
+/**
+ * @brief reads the SLHA input file at once and indexes its content
+ * @param file_name SLHA input file name
+ */
+void SLHA_reader::read_from_file(const std::string& file_name)
+{
+   std::ifstream ifs(file_name, std::ios::in | std::ios::binary);
+
+   if (!ifs.good())
+      throw ReadError(R"(cannot read SLHA file: ")" + file_name + R"(")");
+
+   ifs.seekg(0, std::ios::end);
+   const auto size = ifs.tellg();
+   ifs.seekg(0, std::ios::beg);
+
+   if (size < 0) {
+      read_from_stream(ifs);
+      return;
+   }
+
+   std::string content(static_cast<std::size_t>(size), '\0');
+   ifs.read(&content[0], size);
+   content.resize(static_cast<std::size_t>(ifs.gcount()));
+
+   read_from_string(std::move(content));
+}
+
+/**
+ * @brief reads SLHA input from a stream and indexes its content
+ * @param istr input stream
+ */
+void SLHA_reader::read_from_stream(std::istream& istr)
+{
+   read_from_string(std::string(std::istreambuf_iterator<char>(istr),
+                                std::istreambuf_iterator<char>()));
+}
+
+/**
+ * @brief takes SLHA input from a string and indexes its content
+ * @param content SLHA input
+ */
+void SLHA_reader::read_from_string(std::string content)
+{
+   clear();
+   source = std::move(content);
+   tokenize();
+}
+
+/// splits the source into lines and fields in a single pass
+void SLHA_reader::tokenize()
+{
+   const std::size_t size = source.size();
+   std::size_t pos = 0;
+
+   while (pos < size) {
+      const char* nl = static_cast<const char*>(
+         std::memchr(source.data() + pos, '\n', size - pos));
+      const std::size_t end = nl ? nl - source.data() : size;
+      add_line(pos, end);
+      pos = end + 1;
+   }
+}
+
+/**
+ * Splits the line [begin, end) of the source into fields and adds it
+ * to the current block.  A block definition starts a new block.
+ * Lines which contain only whitespace are ignored.
+ */
+void SLHA_reader::add_line(std::size_t begin, std::size_t end)
+{
+   const char* s = source.data();
+   const std::size_t first_field = fields.size();
+
+   while (end > begin && is_whitespace(s[end - 1]))
+      end--;
+
+   for (std::size_t p = begin; p < end;) {
+      if (is_whitespace(s[p])) {
+         p++;
+      } else if (s[p] == '#') {
+         fields.push_back({p, end - p});
+         break;
+      } else {
+         const std::size_t q = p;
+         while (p < end && !is_whitespace(s[p]) && s[p] != '#')
+            p++;
+         fields.push_back({q, p - q});
+      }
+   }
+
+   const std::size_t number_of_fields = fields.size() - first_field;
+
+   if (number_of_fields == 0)
+      return;
+
+   const Field& f0 = fields[first_field];
+   const bool is_comment = s[f0.pos] == '#';
+   const bool is_block_specifier = !is_comment &&
+      (iequals(s + f0.pos, f0.length, "BLOCK") ||
+       iequals(s + f0.pos, f0.length, "DECAY"));
+   const bool is_block_def = is_block_specifier && number_of_fields > 1 &&
+      s[fields[first_field + 1].pos] != '#';
+
+   lines.push_back({first_field, number_of_fields, !is_comment && !is_block_specifier});
+
+   if (is_block_def) {
+      const Field& f1 = fields[first_field + 1];
+      blocks.push_back({lines.size() - 1, 1});
+      index[to_upper(s + f1.pos, f1.length)].push_back(blocks.size() - 1);
+   } else {
+      // lines before the first block definition form an unnamed block
+      if (blocks.empty()) {
+         blocks.push_back({lines.size() - 1, 0});
+         index[""].push_back(0);
+      }
+      blocks.back().number_of_lines++;
+   }
+}
+
+const std::vector<std::size_t>* SLHA_reader::find_blocks(const std::string& block_name) const
+{
+   const auto it = index.find(to_upper(block_name.data(), block_name.size()));
+   return it != index.cend() ? &it->second : nullptr;
+}
+
+bool SLHA_reader::block_exists(const std::string& block_name) const
+{
+   return find_blocks(block_name) != nullptr;
+}
+
+/**
+ * Applies processor to each (key, value) pair of a SLHA block.
+ * Non-data lines are ignored.
+ *
+ * @param block_name block name
+ * @param processor tuple processor to be applied
+ *
+ * @return scale (or 0 if no scale is defined)
+ */
+double SLHA_reader::read_block(const std::string& block_name, const Tuple_processor& processor) const
+{
+   return for_each_data_line(block_name, [&processor] (const Line& line) {
+      if (line.size() >= 2) {
+         const auto key = line.to_int(0);
+         const auto value = line.to_double(1);
+         processor(key, value);
+      }
+   });
+}
+
+/**
+ * Fills an entry from a SLHA block
+ *
+ * @param block_name block name
+ * @param entry entry to be filled
+ *
+ * @return scale (or 0 if no scale is defined)
+ */
+double SLHA_reader::read_block(const std::string& block_name, double& entry) const
+{
+   return for_each_data_line(block_name, [&entry] (const Line& line) {
+      if (line.size() >= 1)
+         entry = line.to_double(0);
+   });
+}
+
+/**
+ * Reads the value of the first line with the given key.  If there are
+ * several blocks with the given name, the value from the last block
+ * which contains the key is returned.
+ *
+ * @param block_name block name
+ * @param key key of the entry
+ *
+ * @return value (or 0 if the entry does not exist)
+ */
+double SLHA_reader::read_entry(const std::string& block_name, int key) const
+{
+   const auto block_indices = find_blocks(block_name);
+   double entry = 0.;
+
+   if (!block_indices)
+      return entry;
+
+   const std::string key_str(std::to_string(key));
+
+   for (const auto b: *block_indices) {
+      const Block& block = blocks[b];
+      for (std::size_t l = block.first_line;
+           l < block.first_line + block.number_of_lines; l++) {
+         const Line line(get_line(l));
+         if (line.iequals(0, key_str.c_str())) {
+            if (line.is_data_line() && line.size() > 1)
+               entry = line.to_double(1);
+            break;
+         }
+      }
+   }
+
+   return entry;
+}
+
+/**
+ * Reads scale definition from the first SLHA block with the given
+ * name.
+ *
+ * @param block_name block name
+ *
+ * @return scale (or 0 if no scale is defined)
+ */
+double SLHA_reader::read_scale(const std::string& block_name) const
+{
+   const auto block_indices = find_blocks(block_name);
+   double scale = 0.;
+
+   if (!block_indices)
+      return scale;
+
+   const Block& block = blocks[block_indices->front()];
+
+   for (std::size_t l = block.first_line;
+        l < block.first_line + block.number_of_lines; l++) {
+      const Line line(get_line(l));
+      if (!line.is_data_line()) {
+         if (line.size() > 3 &&
+             line.iequals(0, "block") && line.equals(2, "Q="))
+            scale = line.to_double(3);
+         break;
+      }
+   }
+
+   return scale;
+}
+
+} // namespace flexiblesusy
@@ -0,0 +1,244 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef SLHA_READER_H
+#define SLHA_READER_H
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Core>
+#include "error.hpp"
+
+namespace flexiblesusy {
+
+/**
+ * @class SLHA_reader
+ * @brief fast reader for SLHA input
+ *
+ * Reads the SLHA input into a single buffer and splits it in one
+ * pass into lines and fields, which refer to positions in the buffer
+ * instead of being copied.  The blocks are indexed by their
+ * (case-insensitive) names, s.t. reading a block does not require a
+ * search through all blocks.  Numbers are converted in place by
+ * strtod_l() and strtol_l() with the classic "C" locale, s.t. the
+ * conversion does not copy the fields and does not depend on the
+ * global locale.
+ *
+ * The lines and fields follow the conventions of SLHAea: Fields are
+ * separated by whitespace and a comment, starting with '#', forms the
+ * last field of a line.  All lines up to the next block definition
+ * belong to the preceding block, and blocks with the same name are
+ * read in the order of their appearance.
+ */
+class SLHA_reader {
+public:
+   using Tuple_processor = std::function<void(int, double)>;
+
+   /// view of a line of the SLHA input
+   class Line {
+   public:
+      std::size_t size() const { return number_of_fields; }
+      /// returns true if the line contains data (no comment, no block definition)
+      bool is_data_line() const { return data_line; }
+      /// returns true if field i is equal to str
+      bool equals(std::size_t i, const char* str) const;
+      /// returns true if field i is equal to str, ignoring the case
+      bool iequals(std::size_t i, const char* str) const;
+      std::string field(std::size_t) const;
+      int to_int(std::size_t) const;
+      double to_double(std::size_t) const;
+
+   private:
+      friend class SLHA_reader;
+      Line(const SLHA_reader* reader_, std::size_t first_field_,
+           std::size_t number_of_fields_, bool data_line_)
+         : reader(reader_), first_field(first_field_)
+         , number_of_fields(number_of_fields_), data_line(data_line_)
+      {}
+
+      const SLHA_reader* reader;
+      std::size_t first_field;
+      std::size_t number_of_fields;
+      bool data_line;
+   };
+
+   void clear();
+   void read_from_file(const std::string&);
+   void read_from_stream(std::istream&);
+   void read_from_string(std::string);
+   const std::string& get_source() const { return source; }
+
+   bool block_exists(const std::string&) const;
+   double read_block(const std::string&, const Tuple_processor&) const;
+   template <class Derived>
+   double read_block(const std::string&, Eigen::MatrixBase<Derived>&) const;
+   double read_block(const std::string&, double&) const;
+   double read_entry(const std::string&, int) const;
+   double read_scale(const std::string&) const;
+
+   template <class Processor>
+   double for_each_data_line(const std::string&, Processor&&) const;
+
+private:
+   /// field of a line, position and length in the source
+   struct Field {
+      std::size_t pos;
+      std::size_t length;
+   };
+   /// line, range of fields
+   struct Line_info {
+      std::size_t first_field;
+      std::size_t number_of_fields;
+      bool data_line;
+   };
+   /// block, range of lines
+   struct Block {
+      std::size_t first_line;
+      std::size_t number_of_lines;
+   };
+
+   std::string source{};             ///< SLHA input
+   std::vector<Field> fields{};      ///< fields of all lines
+   std::vector<Line_info> lines{};   ///< all non-empty lines
+   std::vector<Block> blocks{};      ///< all blocks
+   /// upper case block name -> indices of blocks in order of appearance
+   std::unordered_map<std::string, std::vector<std::size_t>> index{};
+
+   void tokenize();
+   void add_line(std::size_t, std::size_t);
+   const std::vector<std::size_t>* find_blocks(const std::string&) const;
+   Line get_line(std::size_t l) const {
+      return Line(this, lines[l].first_field, lines[l].number_of_fields,
+                  lines[l].data_line);
+   }
+   template <class Derived>
+   double read_matrix(const std::string&, Eigen::MatrixBase<Derived>&) const;
+   template <class Derived>
+   double read_vector(const std::string&, Eigen::MatrixBase<Derived>&) const;
+};
+
+/**
+ * Applies processor to each data line of all blocks with the given
+ * name.  The scale is read from the block definitions.
+ *
+ * @param block_name block name
+ * @param processor function, which takes a SLHA_reader::Line
+ *
+ * @return scale (or 0 if no scale is defined)
+ */
+template <class Processor>
+double SLHA_reader::for_each_data_line(const std::string& block_name,
+                                       Processor&& processor) const
+{
+   const auto block_indices = find_blocks(block_name);
+   double scale = 0.;
+
+   if (!block_indices)
+      return scale;
+
+   for (const auto b: *block_indices) {
+      const Block& block = blocks[b];
+      for (std::size_t l = block.first_line;
+           l < block.first_line + block.number_of_lines; l++) {
+         const Line line(get_line(l));
+         if (!line.is_data_line()) {
+            // read scale from block definition
+            if (line.size() > 3 &&
+                line.iequals(0, "block") && line.equals(2, "Q="))
+               scale = line.to_double(3);
+            continue;
+         }
+         processor(line);
+      }
+   }
+
+   return scale;
+}
+
+/**
+ * Fills a matrix from a SLHA block
+ *
+ * @param block_name block name
+ * @param matrix matrix to be filled
+ *
+ * @return scale (or 0 if no scale is defined)
+ */
+template <class Derived>
+double SLHA_reader::read_matrix(const std::string& block_name, Eigen::MatrixBase<Derived>& matrix) const
+{
+   if (matrix.cols() <= 1) throw SetupError("Matrix has less than 2 columns");
+
+   const int cols = matrix.cols(), rows = matrix.rows();
+
+   return for_each_data_line(block_name, [&matrix, cols, rows] (const Line& line) {
+      if (line.size() >= 3) {
+         const int i = line.to_int(0) - 1;
+         const int k = line.to_int(1) - 1;
+         if (0 <= i && i < rows && 0 <= k && k < cols)
+            matrix(i,k) = line.to_double(2);
+      }
+   });
+}
+
+/**
+ * Fills a vector from a SLHA block
+ *
+ * @param block_name block name
+ * @param vector vector to be filled
+ *
+ * @return scale (or 0 if no scale is defined)
+ */
+template <class Derived>
+double SLHA_reader::read_vector(const std::string& block_name, Eigen::MatrixBase<Derived>& vector) const
+{
+   if (vector.cols() != 1) throw SetupError("Vector has more than 1 column");
+
+   const int rows = vector.rows();
+
+   return for_each_data_line(block_name, [&vector, rows] (const Line& line) {
+      if (line.size() >= 2) {
+         const int i = line.to_int(0) - 1;
+         if (0 <= i && i < rows)
+            vector(i,0) = line.to_double(1);
+      }
+   });
+}
+
+/**
+ * Fills a matrix or vector from a SLHA block
+ *
+ * @param block_name block name
+ * @param dense matrix or vector to be filled
+ *
+ * @return scale (or 0 if no scale is defined)
+ */
+template <class Derived>
+double SLHA_reader::read_block(const std::string& block_name, Eigen::MatrixBase<Derived>& dense) const
+{
+   return dense.cols() == 1
+      ? read_vector(block_name, dense)
+      : read_matrix(block_name, dense);
+}
+
+} // namespace flexiblesusy
+
+#endif
@@ -54,7 +54,10 @@ const std::array<std::string, Spectrum_generator_settings::NUMBER_OF_OPTIONS> de
    "Higgs 3-loop corrections O(alpha_b alpha_s^2)",
    "Higgs 3-loop corrections O(alpha_t^2 alpha_s)",
    "Higgs 3-loop corrections O(alpha_t^3)",
-   "Higgs 4-loop corrections O(alpha_t alpha_s^3)"
+   "Higgs 4-loop corrections O(alpha_t alpha_s^3)",
+   "record timings of the spectrum calculation",
+   "run semi-analytic trial points in a single RGE system",
+   "cache the real Passarino-Veltman loop functions"
 };
 } // anonymous namespace
 
@@ -131,6 +134,9 @@ void Spectrum_generator_settings::set(const Spectrum_generator_settings::Setting
  * | higgs_3loop_correction_at2_as    | 0, 1                                            | 1 (= enabled)   |
  * | higgs_3loop_correction_at3       | 0, 1                                            | 1 (= enabled)   |
  * | higgs_4loop_correction_at_as3    | 0, 1                                            | 1 (= enabled)   |
+ * | profiling                        | 0 (no) or 1 (yes)                               | 0 (= no)        |
+ * | semi_analytic_batched_running    | 0 (no) or 1 (yes)                               | 0 (= no)        |
+ * | loop_function_cache              | 0 (no) or 1 (yes)                               | 0 (= no)        |
  */
 void Spectrum_generator_settings::reset()
 {
@@ -166,6 +172,9 @@ void Spectrum_generator_settings::reset()
    values[higgs_3loop_correction_at2_as]    = 1.;
    values[higgs_3loop_correction_at3]       = 1.;
    values[higgs_4loop_correction_at_as3]    = 1.;
+   values[profiling]                        = 0.;
+   values[semi_analytic_batched_running]    = 0.;
+   values[loop_function_cache]              = 0.;
 }
 
 Loop_corrections Spectrum_generator_settings::get_loop_corrections() const
@@ -70,6 +70,9 @@ public:
       higgs_3loop_correction_at2_as, ///< [28] Higgs 3-loop correction O(alpha_t^2 alpha_s)
       higgs_3loop_correction_at3,    ///< [29] Higgs 3-loop correction O(alpha_t^3)
       higgs_4loop_correction_at_as3, ///< [30] Higgs 4-loop correction O(alpha_t alpha_s^3)
+      profiling,             ///< [31] record timings of the spectrum calculation
+      semi_analytic_batched_running, ///< [32] run the semi-analytic trial points in a single RGE system
+      loop_function_cache,   ///< [33] cache the real Passarino-Veltman loop functions
       NUMBER_OF_OPTIONS      ///< number of possible options
    };
 
@@ -0,0 +1,221 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef TABLE_INTERPOLATOR_H
+#define TABLE_INTERPOLATOR_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace flexiblesusy {
+
+/**
+ * @class Table_entry
+ * @brief data point \f$(x,y)\f$ of a tabulated function
+ *
+ * Literal type, such that tables can be defined as constexpr arrays.
+ */
+template <typename T>
+struct Table_entry {
+   double x;
+   T y;
+};
+
+/**
+ * @class Table_interpolator
+ * @brief interpolates a function given by a table of N data points
+ *
+ * The abscissae and ordinates are stored in two contiguous arrays.
+ * The interval which contains a given \f$x\f$ is found in O(1) using
+ * a guide table, whose buckets are uniformly spaced in the bit
+ * pattern of \f$x\f$, i.e. in a piecewise linear approximation of
+ * \f$\log_2 x\f$ with \f$2^6\f$ buckets per octave.  The guide table
+ * stores for each bucket the index of the first data point which lies
+ * in this bucket or above, such that only the few points inside one
+ * bucket have to be inspected.  This makes the lookup efficient also
+ * for tables with non-uniformly spaced data points spread over many
+ * orders of magnitude.
+ *
+ * The interpolation functions give the same results as the ones
+ * operating on a std::map.
+ *
+ * @note The abscissae must be sorted in ascending order.  The lookup
+ * is optimized for non-negative abscissae.
+ */
+template <typename T, std::size_t N>
+class Table_interpolator {
+   static_assert(N >= 3, "Table_interpolator requires at least 3 data points");
+public:
+   explicit Table_interpolator(const Table_entry<T> (&)[N]);
+
+   double get_x(std::size_t i) const { return x[i]; }
+   const T& get_y(std::size_t i) const { return y[i]; }
+   static constexpr std::size_t size() { return N; }
+
+   /// index of first data point with x_i >= x (N if none)
+   std::size_t lower_bound(double) const;
+   /// index of first data point with x_i > x (N if none)
+   std::size_t upper_bound(double) const;
+
+   /// linear interpolation (extrapolation outside of the table)
+   T interpolate_linear(double) const;
+   /// quadratic interpolation (extrapolation outside of the table)
+   T interpolate_quadratic(double) const;
+
+private:
+   static const int bits_per_octave = 6;
+
+   std::array<double,N> x{}; ///< abscissae
+   std::array<T,N> y{};      ///< ordinates
+   std::vector<std::size_t> guide{}; ///< index of first point in bucket or above
+   std::uint64_t key_offset{0}; ///< bit pattern of smallest positive abscissa
+   double x_lo{0.};             ///< smallest positive abscissa
+
+   static std::uint64_t bits(double);
+   std::size_t unclamped_key(double) const;
+   std::size_t key(double) const;
+};
+
+/**
+ * Creates an interpolator for the given table, deducing its size.
+ *
+ * @param data table of data points, sorted in ascending order of x
+ *
+ * @return interpolator
+ */
+template <typename T, std::size_t N>
+Table_interpolator<T,N> make_table_interpolator(const Table_entry<T> (&data)[N])
+{
+   return Table_interpolator<T,N>(data);
+}
+
+template <typename T, std::size_t N>
+Table_interpolator<T,N>::Table_interpolator(const Table_entry<T> (&data)[N])
+{
+   for (std::size_t i = 0; i < N; i++) {
+      x[i] = data[i].x;
+      y[i] = data[i].y;
+   }
+
+   const auto first_positive = std::upper_bound(x.cbegin(), x.cend(), 0.);
+
+   if (first_positive != x.cend()) {
+      x_lo = *first_positive;
+      key_offset = bits(x_lo);
+   }
+
+   const std::size_t n_buckets = unclamped_key(x[N - 1]) + 1;
+   guide.resize(n_buckets);
+
+   std::size_t i = 0;
+   for (std::size_t k = 0; k < n_buckets; k++) {
+      while (i < N && unclamped_key(x[i]) < k)
+         i++;
+      guide[k] = i;
+   }
+}
+
+template <typename T, std::size_t N>
+std::uint64_t Table_interpolator<T,N>::bits(double a)
+{
+   std::uint64_t b;
+   std::memcpy(&b, &a, sizeof(b));
+   return b;
+}
+
+/// bucket index, which is a non-decreasing function of x
+template <typename T, std::size_t N>
+std::size_t Table_interpolator<T,N>::unclamped_key(double a) const
+{
+   if (!(a > x_lo))
+      return 0;
+
+   return (bits(a) - key_offset) >> (52 - bits_per_octave);
+}
+
+template <typename T, std::size_t N>
+std::size_t Table_interpolator<T,N>::key(double a) const
+{
+   return std::min(unclamped_key(a), guide.size() - 1);
+}
+
+/**
+ * Returns the index of the first data point with \f$x_i \geq x\f$.
+ * All data points in lower buckets are smaller than \f$x\f$, so the
+ * search starts at the first data point of the bucket of \f$x\f$.
+ */
+template <typename T, std::size_t N>
+std::size_t Table_interpolator<T,N>::lower_bound(double a) const
+{
+   std::size_t i = guide[key(a)];
+
+   while (i < N && x[i] < a)
+      i++;
+
+   return i;
+}
+
+/**
+ * Returns the index of the first data point with \f$x_i > x\f$.
+ */
+template <typename T, std::size_t N>
+std::size_t Table_interpolator<T,N>::upper_bound(double a) const
+{
+   std::size_t i = guide[key(a)];
+
+   while (i < N && x[i] <= a)
+      i++;
+
+   return i;
+}
+
+template <typename T, std::size_t N>
+T Table_interpolator<T,N>::interpolate_linear(double a) const
+{
+   const std::size_t right = std::min(std::max(upper_bound(a), std::size_t(1)), N - 1);
+   const std::size_t left = right - 1;
+
+   const double x_left = (a - x[right]) / (x[left] - x[right]);
+   const double x_right = (a - x[left]) / (x[right] - x[left]);
+
+   return y[left] * x_left + y[right] * x_right;
+}
+
+template <typename T, std::size_t N>
+T Table_interpolator<T,N>::interpolate_quadratic(double a) const
+{
+   const std::size_t right = std::min(std::max(upper_bound(a), std::size_t(2)), N - 1);
+   const std::size_t center = right - 1;
+   const std::size_t left = right - 2;
+
+   const double xl = x[left], xc = x[center], xr = x[right];
+
+   const double x_left = (a - xc) * (a - xr) / ((xl - xc) * (xl - xr));
+   const double x_center = (a - xl) * (a - xr) / ((xc - xl) * (xc - xr));
+   const double x_right = (a - xl) * (a - xc) / ((xr - xl) * (xr - xc));
+
+   return y[left] * x_left + y[center] * x_center + y[right] * x_right;
+}
+
+} // namespace flexiblesusy
+
+#endif
@@ -0,0 +1,92 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef TASK_CONTEXT_H
+#define TASK_CONTEXT_H
+
+#include "error.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace flexiblesusy {
+
+/**
+ * @class Task_context
+ * @brief per-thread settings, which are inherited by submitted tasks
+ *
+ * A module, whose behaviour depends on a per-thread setting, reserves
+ * a slot via reserve_slot() and stores the setting in this slot of
+ * the context of the calling thread (see current()).  A Thread_pool
+ * copies the context of the submitting thread into each task and
+ * installs it in the executing thread while the task runs.  Thus, a
+ * task sees the same settings as the thread which submitted it.
+ */
+class Task_context {
+public:
+   static constexpr std::size_t max_slots = 4; ///< maximum number of slots
+
+   /// returns the context of the calling thread
+   static Task_context& current() noexcept
+   {
+      static thread_local Task_context context;
+      return context;
+   }
+
+   /// reserves a new slot (to be called once per module)
+   static std::size_t reserve_slot()
+   {
+      static std::atomic<std::size_t> number_of_slots{0};
+      const std::size_t slot = number_of_slots.fetch_add(1);
+      if (slot >= max_slots)
+         throw SetupError("Task_context: all slots are reserved");
+      return slot;
+   }
+
+   void* get(std::size_t slot) const noexcept { return slots[slot]; }
+   void set(std::size_t slot, void* value) noexcept { slots[slot] = value; }
+
+private:
+   std::array<void*, max_slots> slots{};
+};
+
+/**
+ * @class Scoped_task_context
+ * @brief installs a context in the calling thread during its lifetime
+ *
+ * The previously installed context is restored by the destructor.
+ */
+class Scoped_task_context {
+public:
+   explicit Scoped_task_context(const Task_context& context) noexcept
+      : previous(Task_context::current())
+   {
+      Task_context::current() = context;
+   }
+   Scoped_task_context(const Scoped_task_context&) = delete;
+   Scoped_task_context& operator=(const Scoped_task_context&) = delete;
+   ~Scoped_task_context() { Task_context::current() = previous; }
+
+private:
+   Task_context previous;
+};
+
+} // namespace flexiblesusy
+
+#endif
@@ -0,0 +1,224 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#include "task_graph.hpp"
+#include "config.h"
+#include "error.hpp"
+#include "profiling.hpp"
+
+#ifdef ENABLE_THREADS
+#include "global_thread_pool.hpp"
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace flexiblesusy {
+
+/**
+ * State of a run of the task graph.  It is shared with the helper
+ * tasks submitted to the thread pool, which may start only after
+ * run() has returned.  Such late helpers find no ready task and
+ * return without accessing the graph.
+ */
+struct Task_graph::State : public std::enable_shared_from_this<Task_graph::State> {
+   const std::vector<Node_data>* nodes{nullptr};
+   std::vector<std::size_t> pending{};   ///< number of unfinished dependencies
+   std::vector<char> skipped{};          ///< a dependency has failed
+   std::deque<Node> ready{};             ///< tasks ready to run
+   std::size_t finished{0};              ///< number of finished tasks
+   std::exception_ptr error{};           ///< first exception thrown
+   std::mutex mutex{};
+   std::condition_variable condition{};
+
+   bool run_one(std::unique_lock<std::mutex>&);
+   void run_all();
+   void schedule(std::size_t);
+};
+
+/**
+ * Adds a task to the graph.
+ *
+ * @param task task
+ * @param dependencies tasks which must be finished before the task is
+ * started (must have been added before)
+ * @param name name of the task, used for profiling
+ *
+ * @return node of the task
+ */
+Task_graph::Node Task_graph::add(Task task, const std::vector<Node>& dependencies,
+                                 const std::string& name)
+{
+   const Node node = nodes.size();
+
+   for (const auto d: dependencies) {
+      if (d >= node) {
+         throw SetupError("Task_graph: dependency on a task which has not been added");
+      }
+   }
+
+   Node_data data;
+   data.task = std::move(task);
+   data.name = name;
+   data.number_of_dependencies = dependencies.size();
+   nodes.push_back(std::move(data));
+
+   for (const auto d: dependencies) {
+      nodes[d].dependents.push_back(node);
+   }
+
+   return node;
+}
+
+/**
+ * Runs all tasks of the graph and returns when all of them are
+ * finished.
+ *
+ * @throw the first exception thrown by one of the tasks
+ */
+void Task_graph::run() const
+{
+   if (nodes.empty()) {
+      return;
+   }
+
+   auto state = std::make_shared<State>();
+   state->nodes = &nodes;
+   state->pending.resize(nodes.size());
+   state->skipped.resize(nodes.size(), 0);
+
+   for (std::size_t i = 0; i < nodes.size(); i++) {
+      state->pending[i] = nodes[i].number_of_dependencies;
+      if (state->pending[i] == 0) {
+         state->ready.push_back(i);
+      }
+   }
+
+#ifdef ENABLE_THREADS
+   // the calling thread runs one of the ready tasks itself
+   const std::size_t helpers = std::min(state->ready.size() - 1,
+                                        global_thread_pool().size());
+   for (std::size_t i = 0; i < helpers; i++) {
+      global_thread_pool().run_task([state] { state->run_all(); });
+   }
+#endif
+
+   std::unique_lock<std::mutex> lock(state->mutex);
+
+   while (state->finished < nodes.size()) {
+      if (!state->run_one(lock)) {
+         state->condition.wait(lock, [&state, this] {
+            return !state->ready.empty() || state->finished == nodes.size();
+         });
+      }
+   }
+
+   if (state->error) {
+      std::rethrow_exception(state->error);
+   }
+}
+
+/**
+ * Runs the next ready task, if there is one.  The lock is released
+ * while the task runs.
+ *
+ * @param lock lock of the mutex
+ *
+ * @return false if no task was ready
+ */
+bool Task_graph::State::run_one(std::unique_lock<std::mutex>& lock)
+{
+   if (ready.empty()) {
+      return false;
+   }
+
+   const Node node = ready.front();
+   ready.pop_front();
+   const Node_data& data = (*nodes)[node];
+
+   if (!skipped[node]) {
+      lock.unlock();
+      try {
+         PROFILE_SCOPE(data.name);
+         data.task();
+      } catch (...) {
+         lock.lock();
+         if (!error) {
+            error = std::current_exception();
+         }
+         skipped[node] = 1;
+         lock.unlock();
+      }
+      lock.lock();
+   }
+
+   std::size_t new_ready = 0;
+
+   for (const auto d: data.dependents) {
+      if (skipped[node]) {
+         skipped[d] = 1;
+      }
+      if (--pending[d] == 0) {
+         ready.push_back(d);
+         new_ready++;
+      }
+   }
+
+   finished++;
+
+   if (new_ready > 1) {
+      schedule(new_ready - 1);
+   }
+
+   condition.notify_all();
+
+   return true;
+}
+
+/**
+ * Runs ready tasks until there are none left.
+ */
+void Task_graph::State::run_all()
+{
+   std::unique_lock<std::mutex> lock(mutex);
+   while (run_one(lock)) {
+   }
+}
+
+/**
+ * Submits helpers to the thread pool, which run the ready tasks.
+ *
+ * @param n number of helpers
+ */
+void Task_graph::State::schedule(std::size_t n)
+{
+#ifdef ENABLE_THREADS
+   const auto self = shared_from_this();
+   for (std::size_t i = 0; i < n; i++) {
+      global_thread_pool().run_task([self] { self->run_all(); });
+   }
+#else
+   (void) n;
+#endif
+}
+
+} // namespace flexiblesusy
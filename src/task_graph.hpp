@@ -0,0 +1,83 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace flexiblesusy {
+
+/**
+ * @class Task_graph
+ * @brief runs tasks with dependencies concurrently
+ *
+ * Each task is added together with the tasks it depends on and an
+ * optional name.  run() starts every task as soon as all of its
+ * dependencies are finished.  If multi-threading is enabled, the
+ * tasks are executed by the global thread pool, where the calling
+ * thread executes ready tasks as well while it waits.  This
+ * guarantees progress even if run() is called from a task of the
+ * thread pool.
+ *
+ * If a task throws, the tasks depending on it are skipped, the
+ * remaining tasks are finished and the first exception is re-thrown
+ * by run().
+ *
+ * If profiling is enabled, the wall time of each named task is
+ * recorded under its name.
+ *
+ * Example:
+ * @code
+ * double a = 0., b = 0., c = 0.;
+ * Task_graph graph;
+ * const auto ta = graph.add([&a] { a = 1.; });
+ * const auto tb = graph.add([&b] { b = 2.; });
+ * graph.add([&] { c = a + b; }, {ta, tb}, "sum");
+ * graph.run();
+ * @endcode
+ */
+class Task_graph {
+public:
+   using Task = std::function<void()>;
+   using Node = std::size_t;
+
+   Node add(Task, const std::vector<Node>& dependencies = {},
+            const std::string& name = "");
+   void clear() { nodes.clear(); }
+   std::size_t size() const { return nodes.size(); }
+   void run() const;
+
+private:
+   struct Node_data {
+      Task task{};
+      std::string name{};
+      std::size_t number_of_dependencies{0};
+      std::vector<Node> dependents{};
+   };
+   struct State;
+
+   std::vector<Node_data> nodes{}; ///< tasks in the order they were added
+};
+
+} // namespace flexiblesusy
+
+#endif
@@ -19,54 +19,195 @@
 #ifndef THREAD_POOL_H
 #define THREAD_POOL_H
 
+#include "config.h"
 #include "logger.hpp"
+#include "raii.hpp"
+#include "task_context.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <functional>
+#include <cstddef>
+#include <deque>
 #include <future>
+#include <iterator>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <new>
 #include <stdexcept>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace flexiblesusy {
 
+/**
+ * @class Thread_pool_task
+ * @brief Move-only type-erased callable with small-buffer storage
+ *
+ * Callables which fit into the internal buffer (and are nothrow
+ * move-constructible) are stored in-place, i.e. without heap
+ * allocation.  Larger callables are stored on the heap.
+ */
+class Thread_pool_task {
+public:
+   Thread_pool_task() = default;
+
+   template <typename F, typename = typename std::enable_if<
+                            !std::is_same<typename std::decay<F>::type, Thread_pool_task>::value>::type>
+   Thread_pool_task(F&& f)
+   {
+      using Fn = typename std::decay<F>::type;
+      construct<Fn>(std::forward<F>(f), Stored_in_place<Fn>());
+   }
+
+   Thread_pool_task(const Thread_pool_task&) = delete;
+   Thread_pool_task& operator=(const Thread_pool_task&) = delete;
+
+   Thread_pool_task(Thread_pool_task&& other) noexcept
+   {
+      move_from(other);
+   }
+
+   Thread_pool_task& operator=(Thread_pool_task&& other) noexcept
+   {
+      if (this != &other) {
+         reset();
+         move_from(other);
+      }
+      return *this;
+   }
+
+   ~Thread_pool_task() { reset(); }
+
+   explicit operator bool() const noexcept { return ops != nullptr; }
+
+   void operator()() { ops->call(&buffer); }
+
+private:
+   static constexpr std::size_t buffer_size = 64;
+   using Buffer = typename std::aligned_storage<buffer_size, alignof(std::max_align_t)>::type;
+
+   struct Operations {
+      void (*call)(void*);
+      void (*move)(void*, void*); ///< move-constructs from 2nd into 1st argument
+      void (*destroy)(void*);
+   };
+
+   template <typename Fn>
+   using Stored_in_place = std::integral_constant<
+      bool, sizeof(Fn) <= buffer_size &&
+            alignof(std::max_align_t) % alignof(Fn) == 0 &&
+            std::is_nothrow_move_constructible<Fn>::value>;
+
+   /// operations for callables stored in the buffer
+   template <typename Fn>
+   struct In_place_operations {
+      static void call(void* b) { (*static_cast<Fn*>(b))(); }
+      static void move(void* dst, void* src) {
+         new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+         static_cast<Fn*>(src)->~Fn();
+      }
+      static void destroy(void* b) { static_cast<Fn*>(b)->~Fn(); }
+      static const Operations* get() {
+         static const Operations o{&call, &move, &destroy};
+         return &o;
+      }
+   };
+
+   /// operations for callables stored on the heap
+   template <typename Fn>
+   struct Heap_operations {
+      static Fn*& ptr(void* b) { return *static_cast<Fn**>(b); }
+      static void call(void* b) { (*ptr(b))(); }
+      static void move(void* dst, void* src) {
+         new (dst) Fn*(ptr(src));
+         ptr(src) = nullptr;
+      }
+      static void destroy(void* b) { delete ptr(b); }
+      static const Operations* get() {
+         static const Operations o{&call, &move, &destroy};
+         return &o;
+      }
+   };
+
+   Buffer buffer;
+   const Operations* ops{nullptr};
+
+   template <typename Fn, typename F>
+   void construct(F&& f, std::true_type)
+   {
+      new (&buffer) Fn(std::forward<F>(f));
+      ops = In_place_operations<Fn>::get();
+   }
+
+   template <typename Fn, typename F>
+   void construct(F&& f, std::false_type)
+   {
+      new (&buffer) Fn*(new Fn(std::forward<F>(f)));
+      ops = Heap_operations<Fn>::get();
+   }
+
+   void move_from(Thread_pool_task& other) noexcept
+   {
+      if (other.ops) {
+         other.ops->move(&buffer, &other.buffer);
+         ops = other.ops;
+         other.ops = nullptr;
+      }
+   }
+
+   void reset() noexcept
+   {
+      if (ops) {
+         ops->destroy(&buffer);
+         ops = nullptr;
+      }
+   }
+};
+
 /**
  * @class Thread_pool
  * @brief A pool of threads
  *
  * Thread_pool represents a collection of threads.  Tasks (callables)
- * can be added to an internal queue.  The tasks will be executed as
- * soon as there is an idle thread.  The destructor of the Thread_pool
- * will wait until all tasks are finished and the queue is empty.
+ * can be added to the pool.  The tasks will be executed as soon as
+ * there is an idle thread.  The destructor of the Thread_pool will
+ * wait until all tasks are finished.
+ *
+ * Each thread owns a task queue.  Tasks submitted from a thread of
+ * the pool are pushed to the queue of that thread, tasks submitted
+ * from outside are distributed round-robin over the queues.  A thread
+ * takes tasks from the back of its own queue and steals from the
+ * front of the other queues when its own queue is empty.  Idle
+ * threads sleep on a condition variable, which is only touched if
+ * there are sleeping threads.
+ *
+ * Each task runs with the Task_context of the thread which submitted
+ * it, such that per-thread settings (e.g. the profiling record or the
+ * loop function cache) carry over to the task.
+ *
+ * A task which waits for the result of another task of the same
+ * pool must use wait(), which runs queued tasks while waiting.
+ * Blocking on std::future::get() instead may deadlock the pool, if
+ * all threads are waiting.  While waiting, a task runs only tasks
+ * which have been submitted by tasks (i.e. sub-tasks, sub-sub-tasks,
+ * etc.), but no task which has been submitted from outside the pool
+ * or from a task at the same nesting depth.  Thus, a task does not
+ * run unrelated coarse-grained tasks (e.g. other points of a scan)
+ * inline while its own sub-tasks are finished.
  *
  * @param pool_size number of threads in the pool
  */
 class Thread_pool {
 public:
    explicit Thread_pool(std::size_t pool_size = std::thread::hardware_concurrency())
+      : queues(pool_size)
    {
       VERBOSE_MSG("launching " << pool_size << " threads ...");
       for (std::size_t i = 0; i < pool_size; ++i)
-         threads.emplace_back(
-            [this] () {
-               for (;;) {
-                  std::function<void()> task;
-
-                  {
-                     std::unique_lock<std::mutex> lock(mutex);
-                     condition.wait(lock, [this]{ return stop || !tasks.empty(); });
-                     if (stop && tasks.empty())
-                        return;
-                     task = std::move(tasks.front());
-                     tasks.pop();
-                  }
-
-                  task();
-               }
-            });
+         threads.emplace_back([this, i] () { work(i); });
    }
 
    Thread_pool(const Thread_pool&) = delete;
@@ -78,7 +219,7 @@ public:
    ~Thread_pool()
    {
       {
-         std::unique_lock<std::mutex> lock(mutex);
+         std::unique_lock<std::mutex> lock(sleep_mutex);
          stop = true;
       }
 
@@ -98,18 +239,13 @@ public:
    {
       using return_t = decltype(task());
 
-      auto ptask = std::make_shared<std::packaged_task<return_t()>>([task](){ return task(); });
-
-      std::future<return_t> fut = ptask->get_future();
+      std::packaged_task<return_t()> ptask(std::forward<Task>(task));
+      std::future<return_t> fut = ptask.get_future();
 
       if (threads.empty()) {
-         (*ptask)();
+         ptask();
       } else {
-         {
-            std::unique_lock<std::mutex> lock(mutex);
-            tasks.emplace([ptask](){ (*ptask)(); });
-         }
-         condition.notify_one();
+         push(Thread_pool_task(std::move(ptask)));
       }
 
       return fut;
@@ -122,22 +258,194 @@ public:
       if (threads.empty()) {
          task();
       } else {
-         {
-            std::unique_lock<std::mutex> lock(mutex);
-            tasks.emplace(std::forward<Task>(task));
-         }
-         condition.notify_one();
+         push(Thread_pool_task(std::forward<Task>(task)));
       }
    }
 
+   /**
+    * Waits for the result of a task.  While the result is not ready,
+    * the calling thread runs queued tasks of the pool, which are
+    * nested deeper than the task it is running (if any).  Thus, tasks
+    * which wait for the results of their sub-tasks cannot deadlock
+    * the pool, even if all threads of the pool are waiting.
+    */
+   template <typename T>
+   T wait(std::future<T>& fut)
+   {
+      while (fut.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+         if (!run_pending_task())
+            fut.wait_for(std::chrono::microseconds(100));
+      }
+      return fut.get();
+   }
+
+   /**
+    * Runs one queued task in the calling thread, which is nested
+    * deeper than the task the calling thread is running (if any).
+    * Returns false if there is no such task.
+    */
+   bool run_pending_task()
+   {
+      if (threads.empty() || number_of_pending_tasks.load() == 0)
+         return false;
+
+      const auto& worker = current_worker();
+      const std::size_t idx = worker.first == this ? worker.second : 0;
+      Queued_task task;
+
+      if (!find_task(idx, current_depth(), task))
+         return false;
+
+      execute(task);
+      return true;
+   }
+
    std::size_t size() const { return threads.size(); }
 
 private:
+   /// task together with the context of the submitting thread
+   struct Queued_task {
+      Thread_pool_task task;
+      Task_context context;
+      std::size_t depth; ///< nesting depth (1 if submitted from outside a task)
+   };
+
+   /// task queue of a single thread
+   struct Queue {
+      std::deque<Queued_task> tasks{};
+      std::mutex mutex{};
+   };
+
+   std::vector<Queue> queues;
    std::vector<std::thread> threads{};
-   std::queue<std::function<void()>> tasks{};
-   std::mutex mutex{};
+   std::atomic<std::size_t> number_of_pending_tasks{0};
+   std::atomic<std::size_t> number_of_sleeping_threads{0};
+   std::atomic<std::size_t> next_queue{0};
+   std::mutex sleep_mutex{};
    std::condition_variable condition{};
    bool stop{false};
+
+   /// pool and queue index of the current thread (if it belongs to a pool)
+   static std::pair<const Thread_pool*, std::size_t>& current_worker()
+   {
+      static thread_local std::pair<const Thread_pool*, std::size_t> worker{nullptr, 0};
+      return worker;
+   }
+
+   /// nesting depth of the task run by the current thread (0 if none)
+   static std::size_t& current_depth()
+   {
+      static thread_local std::size_t depth = 0;
+      return depth;
+   }
+
+   void push(Thread_pool_task&& task)
+   {
+      const auto& worker = current_worker();
+      const std::size_t idx = worker.first == this
+         ? worker.second
+         : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+      // increment before the task becomes visible, such that the
+      // counter never drops below the number of queued tasks
+      number_of_pending_tasks.fetch_add(1);
+
+      {
+         std::lock_guard<std::mutex> lock(queues[idx].mutex);
+         queues[idx].tasks.push_back(
+            Queued_task{std::move(task), Task_context::current(), current_depth() + 1});
+      }
+
+      if (number_of_sleeping_threads.load() > 0) {
+         { std::lock_guard<std::mutex> lock(sleep_mutex); }
+         condition.notify_one();
+      }
+   }
+
+   /// takes the last task of the own queue, which is nested deeper than min_depth
+   bool pop(std::size_t idx, std::size_t min_depth, Queued_task& task)
+   {
+      std::unique_lock<std::mutex> lock(queues[idx].mutex, std::try_to_lock);
+      if (!lock.owns_lock())
+         return false;
+      auto& tasks = queues[idx].tasks;
+      for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+         if (it->depth > min_depth) {
+            task = std::move(*it);
+            tasks.erase(std::next(it).base());
+            number_of_pending_tasks.fetch_sub(1);
+            return true;
+         }
+      }
+      return false;
+   }
+
+   /// takes the first task of a foreign queue, which is nested deeper than min_depth
+   bool steal(std::size_t idx, std::size_t min_depth, Queued_task& task)
+   {
+      std::unique_lock<std::mutex> lock(queues[idx].mutex, std::try_to_lock);
+      if (!lock.owns_lock())
+         return false;
+      auto& tasks = queues[idx].tasks;
+      for (auto it = tasks.begin(); it != tasks.end(); ++it) {
+         if (it->depth > min_depth) {
+            task = std::move(*it);
+            tasks.erase(it);
+            number_of_pending_tasks.fetch_sub(1);
+            return true;
+         }
+      }
+      return false;
+   }
+
+   bool find_task(std::size_t idx, std::size_t min_depth, Queued_task& task)
+   {
+      const std::size_t n = queues.size();
+
+      // two sweeps, because try_lock may fail spuriously under contention
+      for (std::size_t sweep = 0; sweep < 2; ++sweep) {
+         if (pop(idx, min_depth, task))
+            return true;
+         for (std::size_t k = 1; k < n; ++k) {
+            if (steal((idx + k) % n, min_depth, task))
+               return true;
+         }
+      }
+
+      return false;
+   }
+
+   /// runs the task with the context and at the depth of its submitter
+   static void execute(Queued_task& task)
+   {
+      Scoped_task_context scoped_context(task.context);
+      const auto save_depth = make_raii_save(current_depth());
+      current_depth() = task.depth;
+      task.task();
+   }
+
+   void work(std::size_t idx)
+   {
+      current_worker() = std::make_pair(this, idx);
+
+      for (;;) {
+         Queued_task task;
+
+         if (number_of_pending_tasks.load() > 0 && find_task(idx, 0, task)) {
+            execute(task);
+            continue;
+         }
+
+         std::unique_lock<std::mutex> lock(sleep_mutex);
+         if (stop && number_of_pending_tasks.load() == 0)
+            return;
+         number_of_sleeping_threads.fetch_add(1);
+         condition.wait(lock, [this] {
+            return stop || number_of_pending_tasks.load() > 0;
+         });
+         number_of_sleeping_threads.fetch_sub(1);
+      }
+   }
 };
 
 } // namespace flexiblesusy
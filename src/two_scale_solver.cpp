@@ -23,6 +23,7 @@
 #include "initial_guesser.hpp"
 #include "logger.hpp"
 #include "model.hpp"
+#include "profiling.hpp"
 #include "single_scale_constraint.hpp"
 #include "single_scale_matching.hpp"
 #include "two_scale_running_precision.hpp"
@@ -311,6 +312,7 @@ double RGFlow<Two_scale>::Constraint_slider::get_scale() {
 }
 
 void RGFlow<Two_scale>::Constraint_slider::slide() {
+   PROFILE_SCOPE("slide: " + constraint->name());
    VERBOSE_MSG("> \trunning " << model->name() << " to scale " << constraint->get_scale() << " GeV");
    model->run_to(constraint->get_scale());
    VERBOSE_MSG("> \tapplying " << constraint->name());
@@ -335,6 +337,7 @@ double RGFlow<Two_scale>::Matching_slider::get_scale() {
 }
 
 void RGFlow<Two_scale>::Matching_slider::slide() {
+   PROFILE_SCOPE("slide: matching " + m1->name() + " -> " + m2->name());
    VERBOSE_MSG("> \trunning " << m1->name() << " to scale " << matching->get_scale() << " GeV");
    m1->run_to(matching->get_scale());
    VERBOSE_MSG("> \trunning " << m2->name() << " to scale " << matching->get_scale() << " GeV");
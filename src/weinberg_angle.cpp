@@ -24,8 +24,10 @@
 #include "config.h"
 #include "numerics.h"
 
+#include <algorithm>
 #include <limits>
 #include <cmath>
+#include <Eigen/LU>
 
 #define WARN_IF_ZERO(p,fun)                     \
    if (is_zero(p))                              \
@@ -88,6 +90,8 @@ Weinberg_angle::Self_energy_data::Self_energy_data()
  */
 Weinberg_angle::Weinberg_angle()
    : number_of_iterations(20)
+   , number_of_evaluations(0)
+   , iteration_method(Iteration_method::fixed_point)
    , number_of_loops(2)
    , precision_goal(1.0e-8)
    , rho_hat(0.)
@@ -112,6 +116,11 @@ void Weinberg_angle::set_number_of_iterations(int n)
    number_of_iterations = n;
 }
 
+void Weinberg_angle::set_iteration_method(Iteration_method m)
+{
+   iteration_method = m;
+}
+
 void Weinberg_angle::set_number_of_loops(int n)
 {
    number_of_loops = n;
@@ -137,12 +146,34 @@ double Weinberg_angle::get_sin_theta() const
    return sin_theta;
 }
 
+int Weinberg_angle::get_number_of_evaluations() const
+{
+   return number_of_evaluations;
+}
+
 /**
  * Calculates the DR-bar weak mixing angle \f$\sin\hat{\theta}_W\f$ as
  * defined in Eq. (C.3) from hep-ph/9606211 given the Fermi constant,
  * the Z-boson pole mass and the DR-bar electromagnetic coupling as
  * input.
  *
+ * The equations for \f$(\hat{\rho},\sin\hat{\theta}_W)\f$ are solved
+ * with the method set by set_iteration_method():
+ *
+ * - Iteration_method::fixed_point: plain fixed-point iteration
+ * - Iteration_method::anderson: fixed-point iteration with Anderson
+ *   acceleration of depth 1
+ * - Iteration_method::newton: Newton iteration on \f$G(x) - x = 0\f$,
+ *   where \f$G\f$ is the fixed-point map.  The Jacobian is
+ *   calculated once by finite differences and then updated with
+ *   Broyden's method, so each further step needs only one evaluation
+ *   of \f$G\f$.
+ *
+ * If an accelerated step leaves the physical region, a plain
+ * fixed-point step is made instead.  In all cases the iteration stops
+ * as soon as \f$x\f$ and \f$G(x)\f$ agree within the precision goal,
+ * and \f$G(x)\f$ is returned.
+ *
  * The function returns 1 if the iterative procedure to determine the
  * weak mixing angle does not converge.
  *
@@ -153,87 +184,168 @@ double Weinberg_angle::get_sin_theta() const
  */
 int Weinberg_angle::calculate(double rho_start, double sin_start)
 {
-   const double alphaDRbar = data.alpha_em_drbar;
-   const double mz_pole    = data.mz_pole;
-   const double gfermi     = data.fermi_contant;
-
    int iteration = 0;
    bool not_converged = true;
-   double rho_old = rho_start, sin_old = sin_start;
-   double rho_new = rho_start, sin_new = sin_start;
+   Point x_old(Point::Zero()), f_old(Point::Zero());
+   Point x, g;
+   x << rho_start, sin_start;
+   g = x;
+   Eigen::Matrix2d jacobian;
+
+   number_of_evaluations = 0;
 
    while (not_converged && iteration < number_of_iterations) {
-      double deltaR
-         = calculate_delta_r(rho_old, sin_old, data, susy_contributions,
-                             number_of_loops);
+      double deltaR = 0., deltaRho = 0.;
+      g = iterate(x, deltaR, deltaRho);
 
-      if (deltaR > 1.) {
-#if defined(ENABLE_VERBOSE) || defined(ENABLE_DEBUG)
-         WARNING("delta_r > 1");
-#endif
-         deltaR = 0.;
-      }
+      const double precision
+         = Abs(x(0) / g(0) - 1.0) + Abs(x(1) / g(1) - 1.0);
 
-      if (!std::isfinite(deltaR)) {
-#if defined(ENABLE_VERBOSE) || defined(ENABLE_DEBUG)
-         WARNING("delta_r non-finite");
-#endif
-         deltaR = 0.;
+      VERBOSE_MSG("\t\tIteration step " << iteration
+                  << ": prec=" << precision
+                  << " dr=" << deltaR
+                  << " drho=" << deltaRho
+                  << " rho_new=" << g(0)
+                  << " sin_new=" << g(1));
+
+      not_converged = precision >= precision_goal;
+
+      const Point f = g - x;
+      Point x_new = g;
+
+      if (not_converged) {
+         switch (iteration_method) {
+         case Iteration_method::fixed_point:
+            break;
+         case Iteration_method::anderson:
+            if (iteration > 0) {
+               const Point df = f - f_old;
+               const double norm = df.matrix().squaredNorm();
+               if (norm > 0.) {
+                  const double gamma = df.matrix().dot(f.matrix()) / norm;
+                  x_new = g - gamma * (df + x - x_old);
+               }
+            }
+            break;
+         case Iteration_method::newton:
+            if (iteration == 0) {
+               for (int i = 0; i < 2; i++) {
+                  Point xh = x;
+                  const double h = 1e-6 * std::max(Abs(x(i)), 1e-3);
+                  xh(i) += h;
+                  double dr = 0., drho = 0.;
+                  jacobian.col(i) = ((iterate(xh, dr, drho) - xh - f) / h).matrix();
+               }
+            } else {
+               const Eigen::Vector2d dx = (x - x_old).matrix();
+               const double norm = dx.squaredNorm();
+               if (norm > 0.)
+                  jacobian += ((f - f_old).matrix() - jacobian * dx) * dx.transpose() / norm;
+            }
+            if (std::abs(jacobian.determinant()) > std::numeric_limits<double>::epsilon())
+               x_new = x - jacobian.partialPivLu().solve(f.matrix()).array();
+            break;
+         }
+
+         if (!is_valid(x_new))
+            x_new = g;
       }
 
-      double sin2thetasqO4 = Pi * alphaDRbar /
-         (ROOT2 * Sqr(mz_pole) * gfermi * (1.0 - deltaR));
+      x_old = x;
+      f_old = f;
+      x = x_new;
+      iteration++;
+   }
+
+   rho_hat = g(0);
+   sin_theta = g(1);
+
+   const int no_convergence_error = iteration == number_of_iterations;
 
-      if (sin2thetasqO4 >= 0.25)
-         sin2thetasqO4 = 0.25;
+   return no_convergence_error;
+}
 
-      if (sin2thetasqO4 < 0.0)
-         sin2thetasqO4 = 0.0;
+/**
+ * Performs one step of the fixed-point iteration, i.e. calculates
+ * \f$\sin\hat{\theta}_W\f$ from \f$\Delta\hat{r}(\hat{\rho},
+ * \sin\hat{\theta}_W)\f$ and afterwards \f$\hat{\rho}\f$ from
+ * \f$\Delta\hat{\rho}\f$, evaluated at the new value of
+ * \f$\sin\hat{\theta}_W\f$.
+ *
+ * @param x (rho-hat, sin(theta_w))
+ * @param deltaR returns \f$\Delta\hat{r}\f$
+ * @param deltaRho returns \f$\Delta\hat{\rho}\f$
+ *
+ * @return new (rho-hat, sin(theta_w))
+ */
+Weinberg_angle::Point Weinberg_angle::iterate(const Point& x, double& deltaR, double& deltaRho)
+{
+   const double alphaDRbar = data.alpha_em_drbar;
+   const double mz_pole    = data.mz_pole;
+   const double gfermi     = data.fermi_contant;
+   const double rho_old = x(0), sin_old = x(1);
 
-      const double sin2theta = Sqrt(4.0 * sin2thetasqO4);
-      const double theta = 0.5 * ArcSin(sin2theta);
+   number_of_evaluations++;
 
-      sin_new = Sin(theta);
+   deltaR = calculate_delta_r(rho_old, sin_old, data, susy_contributions,
+                              number_of_loops);
 
-      double deltaRho
-         = calculate_delta_rho(rho_old, sin_new, data, susy_contributions,
-                               number_of_loops);
+   if (deltaR > 1.) {
+#if defined(ENABLE_VERBOSE) || defined(ENABLE_DEBUG)
+      WARNING("delta_r > 1");
+#endif
+      deltaR = 0.;
+   }
 
-      if (!std::isfinite(deltaRho)) {
+   if (!std::isfinite(deltaR)) {
 #if defined(ENABLE_VERBOSE) || defined(ENABLE_DEBUG)
-         WARNING("delta_rho non-finite");
+      WARNING("delta_r non-finite");
 #endif
-         deltaRho = 0.;
-      }
+      deltaR = 0.;
+   }
 
-      if (Abs(deltaRho) < 1.0)
-         rho_new = 1.0 / (1.0 - deltaRho);
-      else
-         rho_new = 1.0;
+   double sin2thetasqO4 = Pi * alphaDRbar /
+      (ROOT2 * Sqr(mz_pole) * gfermi * (1.0 - deltaR));
 
-      const double precision
-         = Abs(rho_old / rho_new - 1.0) + Abs(sin_old / sin_new - 1.0);
+   if (sin2thetasqO4 >= 0.25)
+      sin2thetasqO4 = 0.25;
 
-      VERBOSE_MSG("\t\tIteration step " << iteration
-                  << ": prec=" << precision
-                  << " dr=" << deltaR
-                  << " drho=" << deltaRho
-                  << " rho_new=" << rho_new
-                  << " sin_new=" << sin_new);
+   if (sin2thetasqO4 < 0.0)
+      sin2thetasqO4 = 0.0;
 
-      not_converged = precision >= precision_goal;
+   const double sin2theta = Sqrt(4.0 * sin2thetasqO4);
+   const double theta = 0.5 * ArcSin(sin2theta);
 
-      rho_old = rho_new;
-      sin_old = sin_new;
-      iteration++;
+   const double sin_new = Sin(theta);
+
+   deltaRho = calculate_delta_rho(rho_old, sin_new, data, susy_contributions,
+                                  number_of_loops);
+
+   if (!std::isfinite(deltaRho)) {
+#if defined(ENABLE_VERBOSE) || defined(ENABLE_DEBUG)
+      WARNING("delta_rho non-finite");
+#endif
+      deltaRho = 0.;
    }
 
-   rho_hat = rho_new;
-   sin_theta = sin_new;
+   double rho_new = 1.0;
 
-   const int no_convergence_error = iteration == number_of_iterations;
+   if (Abs(deltaRho) < 1.0)
+      rho_new = 1.0 / (1.0 - deltaRho);
 
-   return no_convergence_error;
+   Point result;
+   result << rho_new, sin_new;
+
+   return result;
+}
+
+/**
+ * Checks whether (rho-hat, sin(theta_w)) is a valid starting point
+ * for the next iteration step.
+ */
+bool Weinberg_angle::is_valid(const Point& x)
+{
+   return x.allFinite() && x(0) > 0. && x(1) > 0. && x(1) < 1.;
 }
 
 /**
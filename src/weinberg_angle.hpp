@@ -78,6 +78,13 @@ public:
       double g2;                     ///< SU(2)_L gauge coupling
    };
 
+   /// method to solve the equations for (rho-hat, sin(theta_w))
+   enum class Iteration_method {
+      fixed_point, ///< plain fixed-point iteration (default)
+      anderson,    ///< Anderson-accelerated fixed-point iteration
+      newton       ///< quasi-Newton iteration with finite-difference Jacobian
+   };
+
    Weinberg_angle();
 
    void enable_susy_contributions(); ///< enable susy contributions
@@ -85,10 +92,12 @@ public:
 
    void set_data(const Data&);       ///< set data necessary for the calculation
    void set_number_of_iterations(int); ///< maximum number of iterations
+   void set_iteration_method(Iteration_method); ///< set iteration method
    void set_number_of_loops(int);    ///< set number of loops
    void set_precision_goal(double);  ///< set precision goal
    double get_rho_hat() const;       ///< returns the rho parameter
    double get_sin_theta() const;     ///< returns sin(theta_w)
+   int get_number_of_evaluations() const; ///< number of evaluations of delta_r and delta_rho in the last calculate()
 
    /// calculates the sinus of the Weinberg angle
    int calculate(double rho_start = 1.0, double sin_start = 0.48);
@@ -97,7 +106,11 @@ public:
    static double replace_mtop_in_self_energy_w(double, double, const Self_energy_data&);
 
 private:
+   using Point = Eigen::Array<double,2,1>; ///< (rho-hat, sin(theta_w))
+
    int number_of_iterations; ///< maximum number of iterations
+   int number_of_evaluations;     ///< number of evaluations in the last calculate()
+   Iteration_method iteration_method; ///< iteration method
    int number_of_loops;      ///< number of loops
    double precision_goal;         ///< precision goal
    double rho_hat;                ///< output rho-hat parameter
@@ -105,6 +118,9 @@ private:
    Data data;
    bool susy_contributions;       ///< model type
 
+   Point iterate(const Point&, double&, double&); ///< one fixed-point step
+   static bool is_valid(const Point&);
+
    static double calculate_delta_r(double, double, const Data&, bool add_susy_contributions = true, int number_of_loops = 2);
    static double calculate_delta_rho(double, double, const Data&, bool add_susy_contributions = true, int number_of_loops = 2);
    static double calculate_delta_vb(double, double, const Data&, bool add_susy_contributions = true);
@@ -26,6 +26,7 @@ TEST_SRC := \
 		$(DIR)/test_array_view.cpp \
 		$(DIR)/test_cast_model.cpp \
 		$(DIR)/test_ckm.cpp \
+		$(DIR)/test_columnar_io.cpp \
 		$(DIR)/test_logger.cpp \
 		$(DIR)/test_derivative.cpp \
 		$(DIR)/test_effective_couplings.cpp \
@@ -35,6 +36,7 @@ TEST_SRC := \
 		$(DIR)/test_goldstones.cpp \
 		$(DIR)/test_gsl_vector.cpp \
 		$(DIR)/test_linalg2.cpp \
+		$(DIR)/test_linalg2_batch.cpp \
 		$(DIR)/test_minimizer.cpp \
 		$(DIR)/test_namespace_collisions.cpp \
 		$(DIR)/test_mssm_twoloop_mb.cpp \
@@ -43,6 +45,7 @@ TEST_SRC := \
 		$(DIR)/test_numerics.cpp \
 		$(DIR)/test_pmns.cpp \
 		$(DIR)/test_problems.cpp \
+		$(DIR)/test_profiling.cpp \
 		$(DIR)/test_pv.cpp \
 		$(DIR)/test_raii.cpp \
 		$(DIR)/test_root_finder.cpp \
@@ -50,6 +53,7 @@ TEST_SRC := \
 		$(DIR)/test_sminput.cpp \
 		$(DIR)/test_slha_io.cpp \
 		$(DIR)/test_sum.cpp \
+		$(DIR)/test_task_graph.cpp \
 		$(DIR)/test_threshold_corrections.cpp \
 		$(DIR)/test_threshold_loop_functions.cpp \
 		$(DIR)/test_spectrum_generator_settings.cpp \
@@ -92,7 +96,8 @@ TEST_META := \
 
 ifeq ($(ENABLE_THREADS),yes)
 TEST_SRC += \
-		$(DIR)/test_thread_pool.cpp
+		$(DIR)/test_thread_pool.cpp \
+		$(DIR)/test_thread_pool_benchmark.cpp
 endif
 
 ifneq ($(findstring two_scale,$(SOLVERS)),)
@@ -131,6 +136,7 @@ TEST_SRC += \
 		$(DIR)/test_CMSSM_slha_output.cpp \
 		$(DIR)/test_CMSSM_spectrum.cpp \
 		$(DIR)/test_CMSSM_susy_scale_constraint.cpp \
+		$(DIR)/test_CMSSM_warm_start.cpp \
 		$(DIR)/test_CMSSM_weinberg_angle.cpp \
 		$(DIR)/test_CMSSM_weinberg_angle_meta.cpp
 TEST_SH += \
@@ -322,7 +328,8 @@ endif # ifneq ($(findstring semi_analytic,$(SOLVERS)),)
 
 ifeq ($(WITH_CMSSM) $(WITH_NMSSM),yes yes)
 TEST_SRC += \
-		$(DIR)/test_CMSSM_NMSSM_linking.cpp
+		$(DIR)/test_CMSSM_NMSSM_linking.cpp \
+		$(DIR)/test_CMSSM_NMSSM_self_energies_benchmark.cpp
 endif
 
 ifeq ($(WITH_CMSSM),yes)
@@ -746,6 +753,8 @@ $(DIR)/test_run_all_spectrum_generators.sh.xml: allexec
 
 $(DIR)/test_CMSSM_NMSSM_linking.x: $(LIBCMSSM) $(LIBNMSSM)
 
+$(DIR)/test_CMSSM_NMSSM_self_energies_benchmark.x: $(LIBCMSSM) $(LIBNMSSM)
+
 ifeq ($(ENABLE_LOOPTOOLS),yes)
 $(DIR)/test_pv_fflite.x: $(DIR)/test_pv_crosschecks.cpp src/pv.cpp $(LIBFFLITE)
 		$(CXX) $(CXXFLAGS) $(CPPFLAGS) -o $@ $(call abspathx,$^) $(BOOSTTESTLIBS) $(BOOSTTHREADLIBS) $(FLIBS)
@@ -809,6 +818,8 @@ $(DIR)/test_CMSSM_slha.x: $(LIBCMSSM)
 
 $(DIR)/test_CMSSM_spectrum.x: $(LIBCMSSM)
 
+$(DIR)/test_CMSSM_warm_start.x: $(LIBCMSSM)
+
 $(DIR)/test_CMSSMCKM_high_scale_constraint.x \
 $(DIR)/test_CMSSMCKM_low_scale_constraint.x \
 $(DIR)/test_CMSSMCKM_tree_level_spectrum.x: \
@@ -6,6 +6,7 @@
 #include "test.hpp"
 #include "test_CMSSMSemiAnalytic.hpp"
 #include "CMSSMSemiAnalytic_semi_analytic_solutions.hpp"
+#include "stopwatch.hpp"
 
 using namespace flexiblesusy;
 
@@ -53,3 +54,56 @@ BOOST_AUTO_TEST_CASE( test_CMSSMSemiAnalytic_coefficients )
 
    BOOST_CHECK_EQUAL(get_errors(), 0);
 }
+
+BOOST_AUTO_TEST_CASE( test_CMSSMSemiAnalytic_batched_running )
+{
+   CMSSMSemiAnalytic_input_parameters input;
+   CMSSMSemiAnalytic_mass_eigenstates model(input);
+   setup_CMSSMSemiAnalytic(model, input);
+
+   const double high_scale = 2.e16;
+   model.run_to(high_scale);
+
+   Boundary_values values;
+   setup_high_scale_CMSSMSemiAnalytic(model, values);
+
+   CMSSMSemiAnalytic_semi_analytic_solutions solns, solns_batched;
+   solns.set_input_scale(high_scale);
+   solns.set_output_scale(Electroweak_constants::MZ);
+   solns_batched.set_input_scale(high_scale);
+   solns_batched.set_output_scale(Electroweak_constants::MZ);
+   solns_batched.set_batched_running(true);
+
+   Stopwatch stopwatch;
+
+   stopwatch.start();
+   solns.calculate_coefficients(model);
+   stopwatch.stop();
+   const double time_separate = stopwatch.get_time_in_seconds();
+
+   stopwatch.start();
+   solns_batched.calculate_coefficients(model);
+   stopwatch.stop();
+   const double time_batched = stopwatch.get_time_in_seconds();
+
+   BOOST_TEST_MESSAGE("separate running of the trial points : " << time_separate << " s");
+   BOOST_TEST_MESSAGE("batched running of the trial points: " << time_batched << " s");
+
+   model.run_to(Electroweak_constants::MZ);
+
+   CMSSMSemiAnalytic_mass_eigenstates m1(model), m2(model);
+   solns.evaluate_solutions(m1);
+   solns_batched.evaluate_solutions(m2);
+
+   BOOST_CHECK_CLOSE_FRACTION(m1.get_MassB(), m2.get_MassB(), 1.0e-3);
+   BOOST_CHECK_CLOSE_FRACTION(m1.get_MassG(), m2.get_MassG(), 1.0e-3);
+   BOOST_CHECK_CLOSE_FRACTION(m1.get_BMu(), m2.get_BMu(), 1.0e-3);
+   BOOST_CHECK_CLOSE_FRACTION(m1.get_mHd2(), m2.get_mHd2(), 1.0e-3);
+   BOOST_CHECK_CLOSE_FRACTION(m1.get_mHu2(), m2.get_mHu2(), 1.0e-3);
+
+   TEST_CLOSE_REL(m1.get_TYu(), m2.get_TYu(), 1.0e-3);
+   TEST_CLOSE_REL(m1.get_mq2(), m2.get_mq2(), 1.0e-3);
+   TEST_CLOSE_REL(m1.get_me2(), m2.get_me2(), 1.0e-3);
+
+   BOOST_CHECK_EQUAL(get_errors(), 0);
+}
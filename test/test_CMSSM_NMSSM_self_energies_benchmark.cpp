@@ -0,0 +1,146 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_CMSSM_NMSSM_self_energies_benchmark
+
+#include <boost/test/unit_test.hpp>
+
+#include "CMSSM_input_parameters.hpp"
+#include "CMSSM_two_scale_spectrum_generator.hpp"
+#include "NMSSM_input_parameters.hpp"
+#include "NMSSM_two_scale_spectrum_generator.hpp"
+#include "lowe.h"
+#include "stopwatch.hpp"
+
+#include <complex>
+#include <Eigen/Core>
+
+using namespace flexiblesusy;
+
+namespace {
+
+const int N_calls = 100;
+
+template <typename F>
+double measure_time(F&& f)
+{
+   Stopwatch s;
+   s.start();
+   for (int i = 0; i < N_calls; i++)
+      f();
+   s.stop();
+
+   return s.get_time_in_seconds();
+}
+
+/// fills the self-energy matrix element by element, using the
+/// element function self_energy_<X>_1loop(p, i, k)
+template <int N, typename F>
+Eigen::Matrix<std::complex<double>,N,N> fill_elementwise(F&& f)
+{
+   Eigen::Matrix<std::complex<double>,N,N> m;
+
+   for (int i = 0; i < N; i++)
+      for (int k = 0; k < N; k++)
+         m(i,k) = f(i,k);
+
+   return m;
+}
+
+/**
+ * Compares the self-energy matrix function with the element-wise
+ * evaluation and reports the timings of both.  The element function
+ * evaluates the loop functions for all internal masses as well, so
+ * the element-wise timing is not the timing of the code before the
+ * loop functions were hoisted.
+ */
+template <int N, typename Matrix, typename Element>
+void compare(const std::string& name, Matrix&& matrix, Element&& element)
+{
+   const Eigen::Matrix<std::complex<double>,N,N> se_matrix = matrix();
+   const Eigen::Matrix<std::complex<double>,N,N> se_element =
+      fill_elementwise<N>(element);
+
+   BOOST_CHECK_LE((se_matrix - se_element).cwiseAbs().maxCoeff(),
+                  1e-10 * se_element.cwiseAbs().maxCoeff());
+
+   const double time_matrix = measure_time(matrix);
+   const double time_element = measure_time([&element] () {
+      return fill_elementwise<N>(element);
+   });
+
+   BOOST_TEST_MESSAGE(name << ", " << N_calls << " calls:");
+   BOOST_TEST_MESSAGE("   element-wise   : " << time_element << "s");
+   BOOST_TEST_MESSAGE("   matrix function: " << time_matrix << "s");
+}
+
+CMSSM<Two_scale> calculate_CMSSM_point()
+{
+   CMSSM_input_parameters input;
+   input.m0 = 125.;
+   input.m12 = 500.;
+   input.TanBeta = 10.;
+   input.SignMu = 1.;
+   input.Azero = 0.;
+
+   softsusy::QedQcd qedqcd;
+   CMSSM_spectrum_generator<Two_scale> spectrum_generator;
+   spectrum_generator.run(qedqcd, input);
+
+   BOOST_REQUIRE(!spectrum_generator.get_problems().have_problem());
+
+   return spectrum_generator.get_model();
+}
+
+NMSSM<Two_scale> calculate_NMSSM_point()
+{
+   NMSSM_input_parameters input;
+   input.m0 = 250.;
+   input.m12 = 200.;
+   input.TanBeta = 10.;
+   input.Azero = -500.;
+   input.LambdaInput = 0.1;
+   input.SignvS = 1;
+
+   softsusy::QedQcd qedqcd;
+   NMSSM_spectrum_generator<Two_scale> spectrum_generator;
+   spectrum_generator.run(qedqcd, input);
+
+   BOOST_REQUIRE(!spectrum_generator.get_problems().have_problem());
+
+   return spectrum_generator.get_model();
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE( test_CMSSM_self_energy_matrices )
+{
+   const auto m = calculate_CMSSM_point();
+
+   const double p_Sd = m.get_MSd(0), p_Chi = m.get_MChi(0), p_hh = m.get_Mhh(0);
+
+   compare<6>("CMSSM Sd self-energy",
+              [&m, p_Sd] () { return m.self_energy_Sd_1loop(p_Sd); },
+              [&m, p_Sd] (int i, int k) { return m.self_energy_Sd_1loop(p_Sd, i, k); });
+   compare<4>("CMSSM Chi self-energy (scalar part)",
+              [&m, p_Chi] () { return m.self_energy_Chi_1loop_1(p_Chi); },
+              [&m, p_Chi] (int i, int k) { return m.self_energy_Chi_1loop_1(p_Chi, i, k); });
+   compare<2>("CMSSM hh self-energy",
+              [&m, p_hh] () { return m.self_energy_hh_1loop(p_hh); },
+              [&m, p_hh] (int i, int k) { return m.self_energy_hh_1loop(p_hh, i, k); });
+}
+
+BOOST_AUTO_TEST_CASE( test_NMSSM_self_energy_matrices )
+{
+   const auto m = calculate_NMSSM_point();
+
+   const double p_Su = m.get_MSu(0), p_Chi = m.get_MChi(0), p_hh = m.get_Mhh(0);
+
+   compare<6>("NMSSM Su self-energy",
+              [&m, p_Su] () { return m.self_energy_Su_1loop(p_Su); },
+              [&m, p_Su] (int i, int k) { return m.self_energy_Su_1loop(p_Su, i, k); });
+   compare<5>("NMSSM Chi self-energy (scalar part)",
+              [&m, p_Chi] () { return m.self_energy_Chi_1loop_1(p_Chi); },
+              [&m, p_Chi] (int i, int k) { return m.self_energy_Chi_1loop_1(p_Chi, i, k); });
+   compare<3>("NMSSM hh self-energy",
+              [&m, p_hh] () { return m.self_energy_hh_1loop(p_hh); },
+              [&m, p_hh] (int i, int k) { return m.self_energy_hh_1loop(p_hh, i, k); });
+}
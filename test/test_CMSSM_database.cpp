@@ -11,6 +11,17 @@
 #include "physical_input.hpp"
 #include "test.hpp"
 #include "lowe.h"
+#include "database.hpp"
+#include "stopwatch.hpp"
+#include "config.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef ENABLE_THREADS
+#include <thread>
+#endif
 
 using namespace flexiblesusy;
 
@@ -221,3 +232,85 @@ BOOST_AUTO_TEST_CASE( test_CMSSM_read_write )
    BOOST_REQUIRE((physical_input1.get() - physical_input2.get()).cwiseAbs().maxCoeff() < 1e-10);
    BOOST_REQUIRE((obs1.get() - obs2.get()).cwiseAbs().maxCoeff() < 1e-10);
 }
+
+BOOST_AUTO_TEST_CASE( test_database_insert_throughput )
+{
+   const std::size_t N_rows = 1000, N_columns = 300;
+   const std::string db_file_single("test/test_CMSSM_database_single.db");
+   const std::string db_file_bulk("test/test_CMSSM_database_bulk.db");
+
+   std::remove(db_file_single.c_str());
+   std::remove(db_file_bulk.c_str());
+
+   std::vector<std::string> names(N_columns);
+   for (std::size_t i = 0; i < N_columns; i++)
+      names[i] = "p" + std::to_string(i);
+
+   const auto make_row = [N_columns] (std::size_t r) {
+      return Eigen::ArrayXd::LinSpaced(N_columns, 0., 1.) + r;
+   };
+
+   // one database connection and one INSERT per row, as in to_database()
+   Stopwatch stopwatch;
+   stopwatch.start();
+   for (std::size_t r = 0; r < N_rows; r++) {
+      database::Database db(db_file_single);
+      db.insert("Point", names, make_row(r));
+   }
+   stopwatch.stop();
+   const double single_time = stopwatch.get_time_in_seconds();
+
+   // prepared statement and transactions of 100 rows
+   stopwatch.start();
+   {
+      database::Database_writer writer(db_file_bulk, "Point", names, 100);
+#ifdef ENABLE_THREADS
+      // the rows of the threads are interleaved in a non-deterministic
+      // order, only the set of rows is checked below
+      const std::size_t N_threads = 4;
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < N_threads; t++) {
+         threads.emplace_back([&writer, &make_row, t, N_rows, N_threads] () {
+            for (std::size_t r = t; r < N_rows; r += N_threads)
+               writer.insert(make_row(r));
+         });
+      }
+      for (auto& t: threads)
+         t.join();
+#else
+      for (std::size_t r = 0; r < N_rows; r++)
+         writer.insert(make_row(r));
+#endif
+   }
+   stopwatch.stop();
+   const double bulk_time = stopwatch.get_time_in_seconds();
+
+   {
+      database::Database db_single(db_file_single), db_bulk(db_file_bulk);
+      const Eigen::ArrayXd::Index n_cols = N_columns;
+
+      BOOST_CHECK_EQUAL(db_single.extract("Point", N_rows - 1).size(), n_cols);
+      BOOST_CHECK_EQUAL(db_single.extract("Point", N_rows).size(), 0);
+      BOOST_CHECK_EQUAL(db_bulk.extract("Point", N_rows - 1).size(), n_cols);
+      BOOST_CHECK_EQUAL(db_bulk.extract("Point", N_rows).size(), 0);
+
+      // sum over first column is independent of the insertion order
+      double sum_single = 0., sum_bulk = 0.;
+      for (std::size_t r = 0; r < N_rows; r++) {
+         sum_single += db_single.extract("Point", r)(0);
+         sum_bulk += db_bulk.extract("Point", r)(0);
+      }
+      BOOST_CHECK_EQUAL(sum_single, sum_bulk);
+      BOOST_CHECK_EQUAL(sum_single, N_rows*(N_rows - 1)/2.);
+   }
+
+   std::remove(db_file_single.c_str());
+   std::remove(db_file_bulk.c_str());
+
+   BOOST_TEST_MESSAGE("Inserting " << N_rows << " rows with " << N_columns
+                      << " columns:\n"
+                      "single insert  : " << single_time << "s ("
+                      << N_rows/single_time << " rows/s)\n"
+                      "Database_writer: " << bulk_time << "s ("
+                      << N_rows/bulk_time << " rows/s)\n");
+}
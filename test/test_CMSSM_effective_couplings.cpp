@@ -11,8 +11,11 @@
 #include "effective_couplings.hpp"
 #include "ew_input.hpp"
 #include "linalg2.hpp"
+#include "stopwatch.hpp"
 #include "wrappers.hpp"
 
+#include <cmath>
+
 using namespace flexiblesusy;
 using namespace effective_couplings;
 
@@ -1141,3 +1144,34 @@ BOOST_AUTO_TEST_CASE( test_LO_pseudoscalar_digluon_couplings )
    BOOST_CHECK_CLOSE_FRACTION(-Im(expected_cpAhVGVG_1),
                               Im(obtained_cpAhVGVG_1), 1.0e-10);
 }
+
+BOOST_AUTO_TEST_CASE( test_effective_couplings_benchmark )
+{
+   softsusy::QedQcd qedqcd;
+   Physical_input physical_inputs;
+
+   CMSSM_input_parameters input;
+   CMSSM_mass_eigenstates model;
+   set_test_model_parameters(model, input, qedqcd);
+
+   const auto measure_time = [&] (bool run_couplings, int N) {
+      CMSSM_effective_couplings eff_cp(model, qedqcd, physical_inputs);
+      eff_cp.do_run_couplings(run_couplings);
+      Stopwatch sw;
+      sw.start();
+      for (int i = 0; i < N; i++)
+         eff_cp.calculate_effective_couplings();
+      sw.stop();
+      BOOST_CHECK(std::isfinite(Re(eff_cp.get_eff_CphhVPVP(0))));
+      return sw.get_time_in_seconds();
+   };
+
+   const int N = 100;
+   const double time_fixed = measure_time(false, N);
+   const double time_running = measure_time(true, N);
+
+   BOOST_TEST_MESSAGE("CMSSM_effective_couplings::calculate_effective_couplings(), "
+                      << N << " calls:");
+   BOOST_TEST_MESSAGE("   without running couplings: " << time_fixed << "s");
+   BOOST_TEST_MESSAGE("   with running couplings   : " << time_running << "s");
+}
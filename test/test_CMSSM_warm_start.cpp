@@ -0,0 +1,145 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_CMSSM_warm_start
+
+#include <boost/test/unit_test.hpp>
+
+#include "CMSSM_input_parameters.hpp"
+#include "CMSSM_two_scale_spectrum_generator.hpp"
+#include "continuation.hpp"
+#include "lowe.h"
+#include "scan.hpp"
+#include "spectrum_generator_settings.hpp"
+#include "two_scale_solver.hpp"
+
+#include <vector>
+
+using namespace flexiblesusy;
+
+namespace {
+
+CMSSM_input_parameters make_input(double m0)
+{
+   CMSSM_input_parameters input;
+   input.m0 = m0;
+   input.m12 = 500.;
+   input.TanBeta = 10.;
+   input.SignMu = 1.;
+   input.Azero = 0.;
+   return input;
+}
+
+Spectrum_generator_settings make_settings()
+{
+   Spectrum_generator_settings settings;
+   settings.set(Spectrum_generator_settings::precision, 1.0e-4);
+   return settings;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE( test_warm_start_scan )
+{
+   softsusy::QedQcd qedqcd;
+   const std::vector<double> m0s{125., 126., 127., 128., 129.};
+
+   CMSSM_spectrum_generator<Two_scale> warm;
+   warm.set_settings(make_settings());
+   warm.set_warm_start(true);
+
+   int iterations_cold = 0, iterations_warm = 0;
+
+   for (const auto m0: m0s) {
+      const auto input = make_input(m0);
+
+      CMSSM_spectrum_generator<Two_scale> cold;
+      cold.set_settings(make_settings());
+      cold.run(qedqcd, input);
+      warm.run(qedqcd, input);
+
+      BOOST_REQUIRE(!cold.get_problems().have_problem());
+      BOOST_REQUIRE(!warm.get_problems().have_problem());
+
+      if (m0 != m0s.front()) {
+         iterations_cold += cold.get_number_of_iterations();
+         iterations_warm += warm.get_number_of_iterations();
+      }
+
+      const auto& mc = cold.get_model();
+      const auto& mw = warm.get_model();
+
+      BOOST_CHECK_CLOSE_FRACTION(cold.get_high_scale(), warm.get_high_scale(), 1e-3);
+      BOOST_CHECK_CLOSE_FRACTION(cold.get_susy_scale(), warm.get_susy_scale(), 1e-3);
+      BOOST_CHECK_CLOSE_FRACTION(mc.get_physical().MGlu, mw.get_physical().MGlu, 1e-3);
+      BOOST_CHECK_CLOSE_FRACTION(mc.get_physical().MChi(0), mw.get_physical().MChi(0), 1e-3);
+      BOOST_CHECK_CLOSE_FRACTION(mc.get_physical().Mhh(0), mw.get_physical().Mhh(0), 1e-3);
+      BOOST_CHECK_CLOSE_FRACTION(mc.get_Mu(), mw.get_Mu(), 1e-3);
+   }
+
+   BOOST_TEST_MESSAGE("iterations with cold start: " << iterations_cold);
+   BOOST_TEST_MESSAGE("iterations with warm start: " << iterations_warm);
+
+   BOOST_CHECK_LT(iterations_warm, iterations_cold);
+}
+
+BOOST_AUTO_TEST_CASE( test_warm_start_disabled )
+{
+   softsusy::QedQcd qedqcd;
+
+   CMSSM_spectrum_generator<Two_scale> sg1, sg2;
+   sg1.set_settings(make_settings());
+   sg2.set_settings(make_settings());
+
+   sg1.run(qedqcd, make_input(125.));
+   sg1.run(qedqcd, make_input(130.));
+   sg2.run(qedqcd, make_input(130.));
+
+   BOOST_CHECK_EQUAL(sg1.get_number_of_iterations(), sg2.get_number_of_iterations());
+   BOOST_CHECK_EQUAL(sg1.get_model().get_physical().MGlu,
+                     sg2.get_model().get_physical().MGlu);
+}
+
+BOOST_AUTO_TEST_CASE( test_continuation_scan )
+{
+   using CMSSM_continuation = Continuation<double>;
+
+   softsusy::QedQcd qedqcd;
+   const auto m0s = float_range(125., 725., 6);
+
+   CMSSM_spectrum_generator<Two_scale> sg;
+   sg.set_settings(make_settings());
+
+   CMSSM_continuation continuation(
+      [&sg, &qedqcd] (const Eigen::VectorXd& p, const Eigen::ArrayXd& guess) {
+         sg.set_continuation_guess(guess);
+         sg.run(qedqcd, make_input(p(0)));
+         CMSSM_continuation::Point point;
+         point.result = sg.get_model().get_physical().Mhh(0);
+         point.solution = sg.get_continuation_solution();
+         point.iterations = sg.get_number_of_iterations();
+         return point;
+      });
+
+   const auto points = continuation.run(m0s);
+
+   BOOST_REQUIRE_EQUAL(points.size(), m0s.size());
+   BOOST_CHECK_EQUAL(continuation.get_number_of_failures(), 0);
+
+   long iterations_cold = 0;
+
+   for (std::size_t i = 0; i < m0s.size(); i++) {
+      CMSSM_spectrum_generator<Two_scale> cold;
+      cold.set_settings(make_settings());
+      cold.run(qedqcd, make_input(m0s[i]));
+
+      BOOST_REQUIRE(!cold.get_problems().have_problem());
+      BOOST_CHECK_CLOSE_FRACTION(points[i].result, cold.get_model().get_physical().Mhh(0), 1e-3);
+
+      iterations_cold += cold.get_number_of_iterations();
+   }
+
+   BOOST_TEST_MESSAGE("iterations with cold start  : " << iterations_cold);
+   BOOST_TEST_MESSAGE("iterations with continuation: " << continuation.get_number_of_iterations()
+                      << " (" << continuation.get_number_of_solves() << " solver runs)");
+
+   BOOST_CHECK_LT(continuation.get_number_of_iterations(), iterations_cold);
+}
@@ -560,6 +560,67 @@ BOOST_AUTO_TEST_CASE( test_rho_sinTheta )
    BOOST_CHECK_CLOSE_FRACTION(outrho, fs_rhohat  , 1.0e-10);
 }
 
+BOOST_AUTO_TEST_CASE( test_iteration_methods )
+{
+   Weinberg_angle::Data data;
+   CMSSM<Two_scale> fs;
+   MssmSoftsusy ss;
+   CMSSM_input_parameters input;
+   input.m0 = 125.;
+   input.m12 = 500.;
+   input.TanBeta = 10.;
+   input.SignMu = 1;
+   input.Azero = 0.;
+
+   setup_data(input, fs, ss, data);
+
+   const int N_calls = 1000;
+   const double tol = 1.0e-8;
+
+   const auto run = [&data, tol] (Weinberg_angle::Iteration_method method) {
+      Weinberg_angle weinberg;
+      weinberg.set_number_of_iterations(20);
+      weinberg.set_precision_goal(tol);
+      weinberg.set_iteration_method(method);
+      weinberg.set_data(data);
+      BOOST_REQUIRE(weinberg.calculate() == 0);
+      return weinberg;
+   };
+
+   const auto measure_time = [&run, N_calls] (Weinberg_angle::Iteration_method method) {
+      Stopwatch stopwatch;
+      stopwatch.start();
+      for (int i = 0; i < N_calls; i++)
+         run(method);
+      stopwatch.stop();
+      return stopwatch.get_time_in_seconds();
+   };
+
+   const auto fixed_point = run(Weinberg_angle::Iteration_method::fixed_point);
+   const auto anderson = run(Weinberg_angle::Iteration_method::anderson);
+   const auto newton = run(Weinberg_angle::Iteration_method::newton);
+
+   BOOST_CHECK_CLOSE_FRACTION(fixed_point.get_sin_theta(), anderson.get_sin_theta(), 10*tol);
+   BOOST_CHECK_CLOSE_FRACTION(fixed_point.get_rho_hat()  , anderson.get_rho_hat()  , 10*tol);
+   BOOST_CHECK_CLOSE_FRACTION(fixed_point.get_sin_theta(), newton.get_sin_theta()  , 10*tol);
+   BOOST_CHECK_CLOSE_FRACTION(fixed_point.get_rho_hat()  , newton.get_rho_hat()    , 10*tol);
+
+   BOOST_CHECK_LE(anderson.get_number_of_evaluations(), fixed_point.get_number_of_evaluations());
+   BOOST_CHECK_LE(newton.get_number_of_evaluations(), fixed_point.get_number_of_evaluations());
+
+   const double time_fixed_point = measure_time(Weinberg_angle::Iteration_method::fixed_point);
+   const double time_anderson = measure_time(Weinberg_angle::Iteration_method::anderson);
+   const double time_newton = measure_time(Weinberg_angle::Iteration_method::newton);
+
+   BOOST_TEST_MESSAGE("Weinberg_angle::calculate(), " << N_calls << " calls:");
+   BOOST_TEST_MESSAGE("   fixed point: " << fixed_point.get_number_of_evaluations()
+                      << " evaluations, " << time_fixed_point << "s");
+   BOOST_TEST_MESSAGE("   Anderson   : " << anderson.get_number_of_evaluations()
+                      << " evaluations, " << time_anderson << "s");
+   BOOST_TEST_MESSAGE("   Newton     : " << newton.get_number_of_evaluations()
+                      << " evaluations, " << time_newton << "s");
+}
+
 BOOST_AUTO_TEST_CASE( test_self_energy_top_correction )
 {
    Weinberg_angle::Data data;
@@ -217,3 +217,43 @@ BOOST_AUTO_TEST_CASE( test_NMSSM_beta_functions_benchmark )
 
    BOOST_CHECK_GT(ss_time, 1.5 * fs_time);
 }
+
+BOOST_AUTO_TEST_CASE( test_NMSSM_running_benchmark )
+{
+   NMSSM_input_parameters input;
+   NMSSM<Two_scale> m;
+   NmssmSoftsusy s;
+   setup_NMSSM(m, s, input);
+
+   const double start = m.get_scale(), stop = 1.0e16;
+   const int N_runs = 100;
+
+   NMSSM<Two_scale> m_dynamic(m), m_fixed(m);
+
+   Stopwatch stopwatch;
+   stopwatch.start();
+   for (int i = 0; i < N_runs; i++) {
+      m_dynamic.set(m.get());
+      m_dynamic.Beta_function::run(start, stop);
+   }
+   stopwatch.stop();
+   const double dynamic_time = stopwatch.get_time_in_seconds();
+
+   stopwatch.start();
+   for (int i = 0; i < N_runs; i++) {
+      m_fixed.set(m.get());
+      m_fixed.run(start, stop);
+   }
+   stopwatch.stop();
+   const double fixed_time = stopwatch.get_time_in_seconds();
+
+   const Eigen::ArrayXd pars_dynamic(m_dynamic.get()), pars_fixed(m_fixed.get());
+
+   for (int i = 0; i < pars_dynamic.size(); i++)
+      BOOST_CHECK_CLOSE_FRACTION(pars_dynamic(i), pars_fixed(i), 1.0e-10);
+
+   BOOST_TEST_MESSAGE("Running the NMSSM parameters " << N_runs
+                 << " times from " << start << " to " << stop << " GeV with\n"
+                 "dynamic-size state: " << dynamic_time << "s\n"
+                 "fixed-size state  : " << fixed_time << "s\n");
+}
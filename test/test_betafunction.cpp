@@ -53,6 +53,24 @@ private:
    Eigen::ArrayXd pars;
 };
 
+class Eigen_model_in_place : public Eigen_model {
+public:
+   virtual ~Eigen_model_in_place() {}
+   virtual void fill_beta(Eigen::Ref<Eigen::ArrayXd> beta) const {
+      const Eigen::ArrayXd p(get());
+      for (int i = 0; i < p.rows(); i++)
+         beta(i) = p(i) * p(i) * 0.1 + 0.05 * p(p.rows() - 1 - i);
+   }
+};
+
+class Eigen_model_fixed_size : public Eigen_model_in_place {
+public:
+   virtual ~Eigen_model_fixed_size() {}
+   virtual void run(double x1, double x2, double eps = -1.0) {
+      run_fixed_size<10>(x1, x2, eps);
+   }
+};
+
 BOOST_AUTO_TEST_CASE( test_running )
 {
    DoubleVector pars(10);
@@ -106,3 +124,221 @@ BOOST_AUTO_TEST_CASE( test_custom_precision )
    BOOST_CHECK_EQUAL(rge.display(), ToDoubleVector(eig.get()));
    BOOST_CHECK_EQUAL(rge.displayMu(), eig.get_scale());
 }
+
+BOOST_AUTO_TEST_CASE( test_fill_beta )
+{
+   Eigen::ArrayXd pars(10);
+   for (int i = 0; i < pars.size(); i++)
+      pars(i) = 0.01 * (i + 1);
+
+   Eigen_model eig;
+   Eigen_model_in_place eig_in_place;
+
+   eig.set(pars);
+   eig_in_place.set(pars);
+
+   Eigen::ArrayXd beta(pars.size());
+   eig_in_place.fill_beta(beta);
+
+   BOOST_CHECK_EQUAL(ToDoubleVector(eig.beta()), ToDoubleVector(beta));
+
+   eig.run_to(1.0e10);
+   eig_in_place.run_to(1.0e10);
+
+   BOOST_CHECK_EQUAL(ToDoubleVector(eig.get()), ToDoubleVector(eig_in_place.get()));
+   BOOST_CHECK_EQUAL(eig.get_scale(), eig_in_place.get_scale());
+}
+
+BOOST_AUTO_TEST_CASE( test_custom_integrator )
+{
+   Eigen::ArrayXd pars(10);
+   for (int i = 0; i < pars.size(); i++)
+      pars(i) = 0.01 * (i + 1);
+
+   Eigen_model eig, eig_custom, eig_custom_in_place;
+   int calls = 0, calls_in_place = 0;
+
+   eig.set(pars);
+   eig_custom.set(pars);
+   eig_custom_in_place.set(pars);
+
+   // integrator with derivatives of the form derivs(x, y) -> dydx
+   eig_custom.set_integrator(
+      [&calls] (double x1, double x2, Eigen::ArrayXd& y,
+                Beta_function::Derivs derivs, double eps) {
+         calls++;
+         runge_kutta::Basic_rk_integrator<Eigen::ArrayXd>()(x1, x2, y, derivs, eps);
+      });
+
+   // integrator with derivatives of the form derivs(x, y, dydx)
+   eig_custom_in_place.set_integrator_in_place(
+      [&calls_in_place] (double x1, double x2, Eigen::ArrayXd& y,
+                         const Beta_function::Derivs_in_place& derivs, double eps) {
+         calls_in_place++;
+         runge_kutta::Basic_rk_integrator<Eigen::ArrayXd>()(x1, x2, y, derivs, eps);
+      });
+
+   BOOST_CHECK(!eig_custom.has_default_integrator());
+   BOOST_CHECK(!eig_custom_in_place.has_default_integrator());
+
+   eig.run_to(1.0e10);
+   eig_custom.run_to(1.0e10);
+   eig_custom_in_place.run_to(1.0e10);
+
+   BOOST_CHECK_EQUAL(calls, 1);
+   BOOST_CHECK_EQUAL(calls_in_place, 1);
+
+   for (int i = 0; i < pars.size(); i++) {
+      BOOST_CHECK_CLOSE_FRACTION(eig.get()(i), eig_custom.get()(i), 1e-10);
+      BOOST_CHECK_CLOSE_FRACTION(eig.get()(i), eig_custom_in_place.get()(i), 1e-10);
+   }
+}
+
+BOOST_AUTO_TEST_CASE( test_trajectory_interpolation )
+{
+   Eigen::ArrayXd pars(10);
+   for (int i = 0; i < pars.size(); i++)
+      pars(i) = 0.01 * (i + 1);
+
+   Eigen_model_in_place recorded, integrated;
+   recorded.set(pars);
+   integrated.set(pars);
+
+   recorded.set_trajectory_recording(true);
+   recorded.run_to(1.0e10);
+
+   BOOST_REQUIRE(recorded.get_trajectory());
+   BOOST_CHECK_GT(recorded.get_trajectory()->size(), 2);
+
+   const double scales[] = { 1.0e8, 1.0e4, 200., 100., 3.0e5, 1.0e10 };
+
+   for (const double scale: scales) {
+      const auto trajectory = recorded.get_trajectory();
+      recorded.run_to(scale);
+      integrated.run_to(scale);
+
+      // no re-integration, trajectory is unchanged
+      BOOST_CHECK_EQUAL(trajectory, recorded.get_trajectory());
+      BOOST_CHECK_EQUAL(recorded.get_scale(), scale);
+
+      // the interpolation is as precise as the integration
+      Eigen_model_in_place reference;
+      reference.set(pars);
+      reference.run_to(scale, 1.0e-10);
+
+      for (int i = 0; i < pars.size(); i++) {
+         BOOST_CHECK_CLOSE_FRACTION(integrated.get()(i), reference.get()(i), 1.0e-4);
+         BOOST_CHECK_CLOSE_FRACTION(recorded.get()(i), reference.get()(i), 1.0e-4);
+      }
+   }
+
+   // copies share the trajectory
+   Eigen_model_in_place copy(recorded);
+   BOOST_CHECK_EQUAL(copy.get_trajectory(), recorded.get_trajectory());
+
+   // parameters off the trajectory are integrated
+   Eigen::ArrayXd modified(recorded.get());
+   modified(0) *= 1.1;
+   copy.set(modified);
+   integrated.set(modified);
+   copy.set_trajectory_recording(false);
+   copy.run_to(1.0e4);
+   integrated.run_to(1.0e4);
+
+   BOOST_CHECK_EQUAL(ToDoubleVector(copy.get()), ToDoubleVector(integrated.get()));
+
+   // higher precision requests are integrated
+   const auto trajectory = recorded.get_trajectory();
+   recorded.run_to(1.0e4, 1.0e-6);
+   BOOST_CHECK_NE(trajectory, recorded.get_trajectory());
+
+   recorded.reset();
+   BOOST_CHECK(!recorded.get_trajectory());
+   BOOST_CHECK(!recorded.get_trajectory_recording());
+}
+
+BOOST_AUTO_TEST_CASE( test_fixed_size_running )
+{
+   Eigen::ArrayXd pars(10);
+   for (int i = 0; i < pars.size(); i++)
+      pars(i) = 0.01 * (i + 1);
+
+   Eigen_model_in_place dynamic_size;
+   Eigen_model_fixed_size fixed_size;
+
+   dynamic_size.set(pars);
+   fixed_size.set(pars);
+
+   Eigen::ArrayXd fixed_pars(10);
+   fixed_size.fill_parameters(fixed_pars);
+   BOOST_CHECK_EQUAL(ToDoubleVector(pars), ToDoubleVector(fixed_pars));
+
+   dynamic_size.run_to(1.0e10);
+   fixed_size.run_to(1.0e10);
+
+   BOOST_CHECK_EQUAL(dynamic_size.get_scale(), fixed_size.get_scale());
+
+   for (int i = 0; i < pars.size(); i++)
+      BOOST_CHECK_CLOSE_FRACTION(dynamic_size.get()(i), fixed_size.get()(i), 1.0e-12);
+
+   // wrong number of parameters falls back to dynamic size
+   fixed_size.set_number_of_parameters(9);
+   fixed_size.run_to(100.);
+   dynamic_size.run_to(100.);
+
+   for (int i = 0; i < pars.size(); i++)
+      BOOST_CHECK_CLOSE_FRACTION(dynamic_size.get()(i), fixed_size.get()(i), 1.0e-12);
+}
+
+BOOST_AUTO_TEST_CASE( test_integrate )
+{
+   Eigen::ArrayXd pars(10);
+   for (int i = 0; i < pars.size(); i++)
+      pars(i) = 0.01 * (i + 1);
+
+   Eigen_model eig, eig_custom;
+   int calls = 0;
+
+   eig.set(pars);
+   eig_custom.set(pars);
+
+   eig_custom.set_integrator_in_place(
+      [&calls] (double x1, double x2, Eigen::ArrayXd& y,
+                const Beta_function::Derivs_in_place& derivs, double eps) {
+         calls++;
+         runge_kutta::Basic_rk_integrator<Eigen::ArrayXd>()(x1, x2, y, derivs, eps);
+      });
+
+   // integrate the RGEs of the model outside of the model
+   Eigen_model tmp;
+   const Beta_function::Derivs_in_place derivs =
+      [&tmp] (double, const Eigen::ArrayXd& y, Eigen::ArrayXd& dydx) {
+         tmp.set(y);
+         dydx = tmp.beta();
+      };
+
+   Eigen::ArrayXd y(pars), y_custom(pars);
+   eig.integrate(100., 1.0e10, y, derivs);
+   eig_custom.integrate(100., 1.0e10, y_custom, derivs);
+
+   BOOST_CHECK_EQUAL(calls, 1);
+
+   // the models are not modified
+   BOOST_CHECK_EQUAL(eig.get_scale(), 100.);
+   BOOST_CHECK_EQUAL(ToDoubleVector(eig.get()), ToDoubleVector(pars));
+
+   eig.run_to(1.0e10);
+
+   for (int i = 0; i < pars.size(); i++) {
+      BOOST_CHECK_CLOSE_FRACTION(eig.get()(i), y(i), 1e-12);
+      BOOST_CHECK_CLOSE_FRACTION(eig.get()(i), y_custom(i), 1e-12);
+   }
+
+   BOOST_CHECK_THROW(eig.integrate(0., 100., y, derivs), NonPerturbativeRunningError);
+
+   // no integration without loops
+   eig.set_loops(0);
+   y = pars;
+   eig.integrate(100., 1.0e10, y, derivs);
+   BOOST_CHECK_EQUAL(ToDoubleVector(y), ToDoubleVector(pars));
+}
@@ -0,0 +1,171 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_columnar_io
+
+#include <boost/test/unit_test.hpp>
+
+#include "columnar_io.hpp"
+#include "error.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+using namespace flexiblesusy;
+using namespace flexiblesusy::columnar;
+
+namespace {
+
+Eigen::ArrayXd make_row(std::size_t r, std::size_t n)
+{
+   return Eigen::ArrayXd::LinSpaced(n, 0., n - 1.) + 100. * r;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE( test_write_read )
+{
+   const std::string file_name("test/test_columnar_io.bin");
+   const std::vector<std::string> names{"Q", "MASS(25)", "NMIX(1,1)"};
+   const std::size_t N = 25;
+
+   std::remove(file_name.c_str());
+
+   {
+      Columnar_writer writer(file_name, names, 10);
+      for (std::size_t r = 0; r < N; r++)
+         writer.append(make_row(r, names.size()));
+   }
+
+   Columnar_reader reader(file_name);
+
+   BOOST_CHECK(reader.get_names() == names);
+   BOOST_CHECK_EQUAL(reader.get_number_of_rows(), N);
+
+   for (std::size_t r = 0; r < N; r++)
+      BOOST_CHECK((reader.get_row(r) == make_row(r, names.size())).all());
+
+   const Eigen::ArrayXd col = reader.get_column("MASS(25)");
+   BOOST_REQUIRE_EQUAL(col.size(), N);
+   for (std::size_t r = 0; r < N; r++)
+      BOOST_CHECK_EQUAL(col(r), 1. + 100. * r);
+
+   BOOST_CHECK_THROW(reader.get_column("MASS(35)"), OutOfBoundsError);
+   BOOST_CHECK_THROW(reader.get_row(N), OutOfBoundsError);
+
+   std::remove(file_name.c_str());
+}
+
+BOOST_AUTO_TEST_CASE( test_append )
+{
+   const std::string file_name("test/test_columnar_io_append.bin");
+   const std::vector<std::string> names{"a", "b"};
+
+   std::remove(file_name.c_str());
+
+   for (std::size_t r = 0; r < 3; r++) {
+      Columnar_writer writer(file_name, names);
+      writer.append(make_row(r, names.size()));
+   }
+
+   Columnar_reader reader(file_name);
+   BOOST_CHECK_EQUAL(reader.get_number_of_rows(), 3);
+   BOOST_CHECK_EQUAL(reader.get_row(2)(1), 201.);
+
+   // columns do not match
+   BOOST_CHECK_THROW(Columnar_writer(file_name, {"a", "c"}), SetupError);
+
+   std::remove(file_name.c_str());
+}
+
+BOOST_AUTO_TEST_CASE( test_incomplete_chunk )
+{
+   const std::string file_name("test/test_columnar_io_incomplete.bin");
+   const std::vector<std::string> names{"a", "b"};
+
+   std::remove(file_name.c_str());
+
+   {
+      Columnar_writer writer(file_name, names);
+      writer.append(make_row(0, names.size()));
+   }
+
+   // append chunk header without values
+   {
+      std::ofstream ostr(file_name, std::ios::binary | std::ios::app);
+      const std::uint64_t rows = 5;
+      ostr.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+   }
+
+   Columnar_reader reader(file_name);
+   BOOST_CHECK_EQUAL(reader.get_number_of_rows(), 1);
+
+   std::remove(file_name.c_str());
+}
+
+BOOST_AUTO_TEST_CASE( test_writer_removes_incomplete_chunk )
+{
+   const std::string file_name("test/test_columnar_io_repair.bin");
+   const std::vector<std::string> names{"a", "b"};
+
+   std::remove(file_name.c_str());
+
+   {
+      Columnar_writer writer(file_name, names);
+      writer.append(make_row(0, names.size()));
+   }
+
+   // append chunk of 5 rows with only one value
+   {
+      std::ofstream ostr(file_name, std::ios::binary | std::ios::app);
+      const std::uint64_t rows = 5;
+      const double value = 1.;
+      ostr.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+      ostr.write(reinterpret_cast<const char*>(&value), sizeof(value));
+   }
+
+   {
+      Columnar_writer writer(file_name, names);
+      writer.append(make_row(1, names.size()));
+   }
+
+   Columnar_reader reader(file_name);
+   BOOST_REQUIRE_EQUAL(reader.get_number_of_rows(), 2);
+   BOOST_CHECK((reader.get_row(0) == make_row(0, names.size())).all());
+   BOOST_CHECK((reader.get_row(1) == make_row(1, names.size())).all());
+
+   std::remove(file_name.c_str());
+}
+
+BOOST_AUTO_TEST_CASE( test_concurrent_writers )
+{
+   const std::string file_name("test/test_columnar_io_concurrent.bin");
+   const std::vector<std::string> names{"a", "b", "c"};
+   const std::size_t N = 100;
+
+   std::remove(file_name.c_str());
+
+   {
+      // two writers with interleaved chunks of different sizes
+      Columnar_writer writer1(file_name, names, 7);
+      Columnar_writer writer2(file_name, names, 3);
+
+      for (std::size_t r = 0; r < N; r++) {
+         writer1.append(make_row(r, names.size()));
+         writer2.append(make_row(N + r, names.size()));
+      }
+   }
+
+   Columnar_reader reader(file_name);
+   BOOST_REQUIRE_EQUAL(reader.get_number_of_rows(), 2*N);
+
+   // each row must be one of the written rows
+   const Eigen::ArrayXd col = reader.get_column("a");
+   std::vector<double> values(col.data(), col.data() + col.size());
+   std::sort(values.begin(), values.end());
+
+   for (std::size_t r = 0; r < 2*N; r++)
+      BOOST_CHECK_EQUAL(values[r], 100. * r);
+
+   std::remove(file_name.c_str());
+}
@@ -6,8 +6,14 @@
 #include <boost/test/floating_point_comparison.hpp>
 
 #include "effective_couplings.hpp"
+#include "stopwatch.hpp"
+#include "table_interpolator.hpp"
 #include "wrappers.hpp"
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 using namespace flexiblesusy;
 using namespace effective_couplings;
 
@@ -84,3 +90,91 @@ BOOST_AUTO_TEST_CASE( test_AP12 )
    BOOST_CHECK_CLOSE_FRACTION(Re(AP12(9.8)), -0.08170543420654755, 1.0e-14);
    BOOST_CHECK_CLOSE_FRACTION(Im(AP12(9.8)), 0.5795253251779525, 1.0e-14);
 }
+
+BOOST_AUTO_TEST_CASE( test_table_interpolator )
+{
+   const Table_entry<double> data[] = {
+      {0., 1.}, {1e-3, 2.}, {0.1, 0.}, {0.2, 3.}, {0.2001, 3.5},
+      {1., -1.}, {2., 4.}, {2.5, 5.}, {100., 1.}, {1e5, 2.}
+   };
+   const auto interp = make_table_interpolator(data);
+
+   std::vector<double> xs;
+   std::map<double,std::complex<double> > map;
+   for (const auto& d: data) {
+      xs.push_back(d.x);
+      map.emplace(d.x, d.y);
+   }
+
+   std::vector<double> points{-1., 0., 1e-10, 1e-3, 0.15, 0.2, 0.20005, 2.,
+                              3., 99., 100., 101., 1e5, 1e6};
+   for (int i = 0; i < 1000; i++)
+      points.push_back(-0.5 + 1.1e-4 * i * i);
+
+   for (const auto x: points) {
+      BOOST_CHECK_EQUAL(interp.lower_bound(x),
+                        std::lower_bound(xs.cbegin(), xs.cend(), x) - xs.cbegin());
+      BOOST_CHECK_EQUAL(interp.upper_bound(x),
+                        std::upper_bound(xs.cbegin(), xs.cend(), x) - xs.cbegin());
+      BOOST_CHECK_EQUAL(interp.interpolate_linear(x),
+                        Re(linear_interpolation(x, map)));
+      BOOST_CHECK_EQUAL(interp.interpolate_quadratic(x),
+                        Re(quadratic_interpolation(x, map)));
+   }
+}
+
+BOOST_AUTO_TEST_CASE( test_diphoton_fermion_loop_tables )
+{
+   const int N = 10000;
+   const double m_loop = 1.;
+   std::vector<double> m_decays(N);
+
+   for (int i = 0; i < N; i++)
+      m_decays[i] = 2. * Sqrt(75. * i / N);
+
+   // interpolation in the std::map, as done before the introduction
+   // of the Table_interpolator
+   const auto map_loop = [m_loop] (
+      double m_decay, std::map<double,std::complex<double> > (*get_data)()) {
+      const double tau = 0.25 * Sqr(m_decay) / Sqr(m_loop);
+      return quadratic_interpolation(tau, get_data());
+   };
+
+   for (const auto m_decay: m_decays) {
+      BOOST_CHECK_EQUAL(scalar_diphoton_fermion_loop(m_decay, m_loop),
+                        map_loop(m_decay, get_scalar_fermion_loop_data));
+      BOOST_CHECK_EQUAL(pseudoscalar_diphoton_fermion_loop(m_decay, m_loop),
+                        map_loop(m_decay, get_pseudoscalar_fermion_loop_data));
+   }
+
+   // limit tau >= 75 is matched at the table point tau = 75
+   BOOST_CHECK_CLOSE_FRACTION(
+      Re(scalar_diphoton_fermion_loop(2. * Sqrt(75.), m_loop)),
+      Re(get_scalar_fermion_loop_data().at(75.)), 1e-14);
+   BOOST_CHECK_CLOSE_FRACTION(
+      Im(pseudoscalar_diphoton_fermion_loop(2. * Sqrt(75.), m_loop)),
+      Im(get_pseudoscalar_fermion_loop_data().at(75.)), 1e-14);
+
+   std::complex<double> sum_table, sum_map;
+   Stopwatch sw;
+
+   sw.start();
+   for (const auto m_decay: m_decays)
+      sum_table += scalar_diphoton_fermion_loop(m_decay, m_loop);
+   sw.stop();
+   const double time_table = sw.get_time_in_seconds();
+
+   sw.start();
+   for (const auto m_decay: m_decays)
+      sum_map += map_loop(m_decay, get_scalar_fermion_loop_data);
+   sw.stop();
+   const double time_map = sw.get_time_in_seconds();
+
+   BOOST_CHECK_EQUAL(sum_table, sum_map);
+
+   BOOST_TEST_MESSAGE("scalar_diphoton_fermion_loop, " << N << " calls:");
+   BOOST_TEST_MESSAGE("   std::map          : " << time_map << "s");
+   BOOST_TEST_MESSAGE("   Table_interpolator: " << time_table << "s");
+
+   BOOST_CHECK_LT(time_table, time_map);
+}
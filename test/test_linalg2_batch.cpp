@@ -0,0 +1,210 @@
+// ====================================================================
+// This file is part of FlexibleSUSY.
+//
+// FlexibleSUSY is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+//
+// FlexibleSUSY is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FlexibleSUSY.  If not, see
+// <http://www.gnu.org/licenses/>.
+// ====================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_linalg2_batch
+
+#include <boost/test/unit_test.hpp>
+
+#include "linalg2.hpp"
+#include "stopwatch.hpp"
+
+#include <array>
+#include <complex>
+#include <limits>
+
+using namespace flexiblesusy;
+
+namespace {
+
+template <int N>
+using CMatrix = Eigen::Matrix<std::complex<double>, N, N>;
+
+template <int N>
+using Batch = std::array<CMatrix<N>, N>;
+
+template <int N>
+CMatrix<N> random_hermitian()
+{
+   const CMatrix<N> m = CMatrix<N>::Random();
+   return (m + m.adjoint())/2;
+}
+
+/**
+ * Creates a batch of N hermitian matrices which differ by small
+ * momentum-dependent corrections, similar to M_tree - Sigma(p_i).
+ */
+template <int N>
+Batch<N> make_batch(const CMatrix<N>& tree)
+{
+   const CMatrix<N> se = random_hermitian<N>();
+   Batch<N> m;
+
+   for (int i = 0; i < N; i++)
+      m[i] = tree - 0.01*(1. + 0.1*i)*se;
+
+   return m;
+}
+
+/// diagonalizes each matrix of the batch separately, as done before
+/// the introduction of fs_diagonalize_hermitian_batch()
+template <int N>
+void diagonalize_separately(const Batch<N>& m, Eigen::Array<double,N,1>& w,
+                            CMatrix<N>& z, int idx)
+{
+   for (int i = 0; i < N; i++) {
+      Eigen::Array<double,N,1> wi;
+      CMatrix<N> zi;
+      fs_diagonalize_hermitian(m[i], wi, zi);
+      w[i] = wi[i];
+      if (i == idx) z = zi;
+   }
+}
+
+template <int N>
+void check_batch(int idx)
+{
+   const double eps = std::numeric_limits<double>::epsilon();
+   const CMatrix<N> tree = random_hermitian<N>();
+   const Batch<N> m = make_batch<N>(tree);
+
+   // start from tree-level rotation
+   Eigen::Array<double,N,1> w_tree;
+   CMatrix<N> z;
+   fs_diagonalize_hermitian(tree, w_tree, z);
+
+   Eigen::Array<double,N,1> w, w_ref;
+   CMatrix<N> z_ref;
+   double w_errbd = 0.;
+   fs_diagonalize_hermitian_batch(m, w, z, idx, w_errbd);
+   diagonalize_separately<N>(m, w_ref, z_ref, idx);
+
+   BOOST_CHECK_LT(w_errbd, 1e-10);
+
+   for (int i = 0; i < N; i++)
+      BOOST_CHECK_SMALL(w[i] - w_ref[i], 1000*eps);
+
+   const CMatrix<N> diag = z * m[idx] * z.adjoint();
+   const double norm = m[idx].norm();
+
+   for (int i = 0; i < N; i++)
+      for (int k = 0; k < N; k++)
+         BOOST_CHECK_SMALL(std::abs(diag(i,k)) * (i == k ? 0. : 1.), 1000*eps*norm);
+
+   // check that the eigenvector matrix is unitary
+   BOOST_CHECK_SMALL((z * z.adjoint() - CMatrix<N>::Identity()).norm(), 1000*eps);
+}
+
+template <int N>
+void benchmark_batch()
+{
+   const int N_calls = 10000;
+   const CMatrix<N> tree = random_hermitian<N>();
+   const Batch<N> m = make_batch<N>(tree);
+
+   Eigen::Array<double,N,1> w_tree, w_batch, w_separate;
+   CMatrix<N> z_tree, z_batch, z_separate;
+   fs_diagonalize_hermitian(tree, w_tree, z_tree);
+
+   Stopwatch sw;
+
+   sw.start();
+   for (int i = 0; i < N_calls; i++) {
+      z_batch = z_tree;
+      fs_diagonalize_hermitian_batch(m, w_batch, z_batch, 0);
+   }
+   sw.stop();
+   const double time_batch = sw.get_time_in_seconds();
+
+   sw.start();
+   for (int i = 0; i < N_calls; i++)
+      diagonalize_separately<N>(m, w_separate, z_separate, 0);
+   sw.stop();
+   const double time_separate = sw.get_time_in_seconds();
+
+   BOOST_CHECK_SMALL((w_batch - w_separate).abs().maxCoeff(), 1e-12);
+
+   BOOST_TEST_MESSAGE(N << "x" << N << " complex hermitian, " << N_calls << " batches:");
+   BOOST_TEST_MESSAGE("   separate: " << time_separate << "s");
+   BOOST_TEST_MESSAGE("   batch   : " << time_batch << "s");
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE( test_batch )
+{
+   for (int i = 0; i < 10; i++) {
+      check_batch<2>(i % 2);
+      check_batch<3>(i % 3);
+      check_batch<4>(i % 4);
+      check_batch<5>(i % 5);
+      check_batch<6>(i % 6);
+   }
+}
+
+BOOST_AUTO_TEST_CASE( test_batch_real )
+{
+   const double eps = std::numeric_limits<double>::epsilon();
+   Eigen::Matrix<double,3,3> tree;
+   tree << 1., 0.2, 0.1,
+           0.2, 4., 0.3,
+           0.1, 0.3, -9.;
+
+   std::array<Eigen::Matrix<double,3,3>,3> m;
+   for (int i = 0; i < 3; i++)
+      m[i] = tree + 0.01*i*Eigen::Matrix<double,3,3>::Ones();
+
+   Eigen::Array<double,3,1> w, wi;
+   Eigen::Matrix<double,3,3> z(Eigen::Matrix<double,3,3>::Identity()), zi;
+   fs_diagonalize_hermitian_batch(m, w, z, 2);
+
+   for (int i = 0; i < 3; i++) {
+      fs_diagonalize_hermitian(m[i], wi, zi);
+      BOOST_CHECK_SMALL(w[i] - wi[i], 100*eps);
+   }
+
+   // the eigenvalues of m[2] are sorted by their absolute values, so
+   // the last row of z is the eigenvector of the eigenvalue near -9
+   BOOST_CHECK(std::abs(z.row(2).dot(Eigen::Vector3d(0., 0., 1.))) > 0.99);
+   BOOST_CHECK_SMALL((z.transpose() * wi.matrix().asDiagonal() * z - m[2]).norm(), 100*eps*m[2].norm());
+}
+
+BOOST_AUTO_TEST_CASE( test_batch_non_unitary_start )
+{
+   const double eps = std::numeric_limits<double>::epsilon();
+   const Batch<4> m = make_batch<4>(random_hermitian<4>());
+
+   Eigen::Array<double,4,1> w, w_ref;
+   CMatrix<4> z(CMatrix<4>::Zero()), z_ref;
+   fs_diagonalize_hermitian_batch(m, w, z, 1);
+   diagonalize_separately<4>(m, w_ref, z_ref, 1);
+
+   for (int i = 0; i < 4; i++)
+      BOOST_CHECK_SMALL(w[i] - w_ref[i], 1000*eps);
+
+   BOOST_CHECK_SMALL((z * z.adjoint() - CMatrix<4>::Identity()).norm(), 1000*eps);
+}
+
+BOOST_AUTO_TEST_CASE( test_batch_benchmark )
+{
+   benchmark_batch<2>();
+   benchmark_batch<3>();
+   benchmark_batch<4>();
+   benchmark_batch<5>();
+   benchmark_batch<6>();
+}
@@ -56,3 +56,46 @@ BOOST_AUTO_TEST_CASE( test_to_recall )
    BOOST_TEST_MESSAGE(lowe_Mz);
    BOOST_TEST_MESSAGE(lowe_Mz_new);
 }
+
+BOOST_AUTO_TEST_CASE( test_to_cache )
+{
+   QedQcd::enable_cache(true);
+   QedQcd::clear_cache();
+
+   QedQcd lowe;
+   lowe.setPoleMt(173.5);
+   lowe.setAlphaSInput(0.118);
+
+   QedQcd lowe_cached(lowe), lowe_uncached(lowe), lowe_other(lowe);
+
+   lowe.to(lowe.displayPoleMZ());
+   lowe_cached.to(lowe_cached.displayPoleMZ());
+
+   QedQcd::enable_cache(false);
+   lowe_uncached.to(lowe_uncached.displayPoleMZ());
+   QedQcd::enable_cache(true);
+
+   const auto stats = QedQcd::get_cache_statistics();
+   BOOST_CHECK_EQUAL(stats.hits, 1);
+   BOOST_CHECK_EQUAL(stats.misses, 1);
+   BOOST_CHECK_EQUAL(stats.hit_rate(), 0.5);
+
+   // cached result must be identical to the iteration
+   BOOST_CHECK(lowe_cached == lowe_uncached);
+   BOOST_CHECK_EQUAL(lowe_cached.get_scale(), lowe_uncached.get_scale());
+   BOOST_CHECK_EQUAL(lowe_cached.displayPoleMb(), lowe_uncached.displayPoleMb());
+   BOOST_CHECK_EQUAL(flexiblesusy::MaxRelDiff(lowe_cached.get(), lowe_uncached.get()), 0.);
+
+   // different input or target scale must not hit the cache
+   lowe_other.setAlphaSInput(0.119);
+   lowe_other.to(lowe_other.displayPoleMZ());
+   QedQcd lowe_scale(lowe);
+   lowe_scale.to(100.);
+
+   BOOST_CHECK_EQUAL(QedQcd::get_cache_statistics().misses, 3);
+   BOOST_CHECK_GT(std::abs(lowe_other.displayAlpha(ALPHAS) - lowe_cached.displayAlpha(ALPHAS)), 1e-4);
+
+   QedQcd::clear_cache();
+   BOOST_CHECK_EQUAL(QedQcd::get_cache_statistics().hits, 0);
+   BOOST_CHECK_EQUAL(QedQcd::get_cache_statistics().misses, 0);
+}
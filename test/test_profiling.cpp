@@ -0,0 +1,237 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_profiling
+
+#include <boost/test/unit_test.hpp>
+
+#include "profiling.hpp"
+#include "slha_io.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef ENABLE_THREADS
+#include "thread_pool.hpp"
+#include <future>
+#endif
+
+using namespace flexiblesusy;
+
+#ifdef ENABLE_PROFILING
+
+BOOST_AUTO_TEST_CASE( test_scoped_timer )
+{
+   profiling::Record record;
+
+   {
+      profiling::Scoped_record scoped_record(&record);
+
+      for (int i = 0; i < 3; i++) {
+         profiling::Scoped_timer t("a");
+      }
+
+      {
+         profiling::Scoped_timer t("b");
+      }
+
+      {
+         // empty names are not recorded
+         profiling::Scoped_timer t("");
+      }
+   }
+
+   {
+      // nothing is recorded without a record
+      profiling::Scoped_timer t("c");
+   }
+
+   BOOST_CHECK(profiling::current_record() == nullptr);
+
+   const auto report = record.get_report();
+
+   BOOST_REQUIRE_EQUAL(report.size(), 2);
+   BOOST_CHECK_EQUAL(report.at("a").calls, 3);
+   BOOST_CHECK_EQUAL(report.at("b").calls, 1);
+   BOOST_CHECK_GE(report.at("a").time, 0.);
+
+   record.clear();
+
+   BOOST_CHECK(record.get_report().empty());
+}
+
+#else
+
+BOOST_AUTO_TEST_CASE( test_disabled_profiling )
+{
+   profiling::Record record;
+
+   {
+      profiling::Scoped_record scoped_record(&record);
+      profiling::Scoped_timer t("a");
+      BOOST_CHECK(profiling::current_record() == nullptr);
+   }
+
+   BOOST_CHECK(record.get_report().empty());
+}
+
+#endif
+
+BOOST_AUTO_TEST_CASE( test_profile_scope )
+{
+   profiling::Record record;
+
+   {
+      PROFILE_SCOPE("disabled");
+   }
+
+   {
+      profiling::Scoped_record scoped_record(&record);
+      PROFILE_SCOPE(std::string("ena") + "bled");
+   }
+
+   const auto report = record.get_report();
+
+   BOOST_CHECK_EQUAL(report.count("disabled"), 0);
+
+#ifdef ENABLE_PROFILING
+   BOOST_REQUIRE_EQUAL(report.count("enabled"), 1);
+   BOOST_CHECK_EQUAL(report.at("enabled").calls, 1);
+#else
+   BOOST_CHECK(report.empty());
+#endif
+}
+
+#ifdef ENABLE_PROFILING
+
+BOOST_AUTO_TEST_CASE( test_nested_records )
+{
+   profiling::Record outer, inner;
+
+   {
+      profiling::Scoped_record scoped_outer(&outer);
+      profiling::Scoped_timer t1("outer");
+      {
+         profiling::Scoped_record scoped_inner(&inner);
+         profiling::Scoped_timer t2("inner");
+      }
+      {
+         profiling::Scoped_record scoped_none(nullptr);
+         profiling::Scoped_timer t3("none");
+      }
+      BOOST_CHECK(profiling::current_record() == &outer);
+   }
+
+   const auto report_outer = outer.get_report();
+   const auto report_inner = inner.get_report();
+
+   BOOST_CHECK_EQUAL(report_outer.size(), 1);
+   BOOST_CHECK_EQUAL(report_outer.count("outer"), 1);
+   BOOST_CHECK_EQUAL(report_inner.size(), 1);
+   BOOST_CHECK_EQUAL(report_inner.count("inner"), 1);
+}
+
+#ifdef ENABLE_THREADS
+
+BOOST_AUTO_TEST_CASE( test_concurrent_records )
+{
+   const int number_of_runs = 4;
+   const int number_of_tasks = 20;
+   std::vector<profiling::Record> records(number_of_runs);
+   std::vector<std::thread> threads;
+
+   Thread_pool tp(2);
+
+   // each run records its own timings, including those of its tasks
+   for (int r = 0; r < number_of_runs; r++) {
+      threads.emplace_back([&tp, &records, r] {
+         profiling::Scoped_record scoped_record(&records[r]);
+         std::vector<std::future<void>> results;
+         for (int i = 0; i < number_of_tasks; i++) {
+            results.push_back(tp.run_packaged_task([r] {
+               profiling::Scoped_timer t("run " + std::to_string(r));
+            }));
+         }
+         for (auto& f: results) {
+            tp.wait(f);
+         }
+      });
+   }
+
+   for (auto& t: threads) {
+      t.join();
+   }
+
+   for (int r = 0; r < number_of_runs; r++) {
+      const auto report = records[r].get_report();
+      BOOST_REQUIRE_EQUAL(report.size(), 1);
+      BOOST_CHECK_EQUAL(report.at("run " + std::to_string(r)).calls, number_of_tasks);
+   }
+}
+
+BOOST_AUTO_TEST_CASE( test_task_without_record )
+{
+   Thread_pool tp(1);
+   std::promise<void> started, release;
+
+   // keep the only thread of the pool busy
+   auto blocker = tp.run_packaged_task([&started, &release] {
+      started.set_value();
+      release.get_future().wait();
+   });
+   started.get_future().wait();
+
+   // task of a submitter without record
+   auto task = tp.run_packaged_task([] {
+      profiling::Scoped_timer t("task");
+   });
+
+   profiling::Record record;
+
+   {
+      // the task is run by a thread which has a record
+      profiling::Scoped_record scoped_record(&record);
+      BOOST_CHECK(tp.run_pending_task());
+      BOOST_CHECK(profiling::current_record() == &record);
+   }
+
+   release.set_value();
+   tp.wait(task);
+   tp.wait(blocker);
+
+   BOOST_CHECK(record.get_report().empty());
+}
+
+#endif
+
+#endif
+
+BOOST_AUTO_TEST_CASE( test_slha_profile_block )
+{
+   profiling::Report report;
+   report["RG running"].calls = 10;
+   report["RG running"].time = 0.5;
+   report["solve_ewsb"].calls = 2;
+   report["solve_ewsb"].time = 0.25;
+
+   SLHA_io slha_io;
+   slha_io.set_profile(report);
+
+   std::ostringstream ostr;
+   slha_io.write_to_stream(ostr);
+
+   std::istringstream istr(ostr.str());
+   SLHA_io reader;
+   reader.read_from_stream(istr);
+
+   const auto& data = reader.get_data();
+   const auto block = data.find("FlexibleSUSYProfile");
+
+   BOOST_REQUIRE(block != data.cend());
+
+   const auto line = block->find(std::vector<std::string>{"1"});
+
+   BOOST_REQUIRE(line != block->cend());
+   BOOST_CHECK_EQUAL(std::stoi(line->at(1)), 2);
+   BOOST_CHECK_CLOSE_FRACTION(std::stod(line->at(2)), 0.25, 1e-10);
+}
@@ -33,6 +33,10 @@
 #include "rk.hpp"
 #include <Eigen/Dense>
 
+#ifdef ENABLE_THREADS
+#include <thread>
+#endif
+
 using namespace std;
 using namespace flexiblesusy;
 using namespace flexiblesusy::passarino_veltman;
@@ -278,8 +282,132 @@ BOOST_AUTO_TEST_CASE( test_ReD1G0_numerical )
    }
 }
 
+/// sums the real loop functions over a grid of arguments
+double sum_loop_functions(double q2)
+{
+   double sum = 0.;
+
+   for (int i = 0; i < 10; i++) {
+      for (int k = 0; k < 10; k++) {
+         const double m2a = Sqr(10.*(i + 1)), m2b = Sqr(15.*(k + 1));
+         sum += ReA0(m2a, q2) + ReB0(p2, m2a, m2b, q2)
+            + ReB1(p2, m2a, m2b, q2) + ReB00(p2, m2a, m2b, q2)
+            + ReF0(p2, m2a, m2b, q2) + ReG0(p2, m2a, m2b, q2);
+      }
+   }
+
+   return sum;
+}
+
+BOOST_AUTO_TEST_CASE( test_cache )
+{
+   BOOST_REQUIRE(!is_cache_enabled());
+
+   const double uncached = sum_loop_functions(scale2);
+
+   enable_cache(true);
+   const double first = sum_loop_functions(scale2);
+   const double second = sum_loop_functions(scale2);
+   const double other_scale = sum_loop_functions(4*scale2);
+   enable_cache(false);
+
+   BOOST_CHECK_EQUAL(uncached, first);
+   BOOST_CHECK_EQUAL(uncached, second);
+   BOOST_CHECK_EQUAL(sum_loop_functions(4*scale2), other_scale);
+}
+
+BOOST_AUTO_TEST_CASE( test_scoped_cache )
+{
+   BOOST_REQUIRE(!is_cache_enabled());
+
+   {
+      Scoped_cache scoped_cache(true);
+      BOOST_CHECK(is_cache_enabled());
+      {
+         Scoped_cache inner(false);
+         BOOST_CHECK(!is_cache_enabled());
+      }
+      BOOST_CHECK(is_cache_enabled());
+   }
+
+   BOOST_CHECK(!is_cache_enabled());
+}
+
+#ifdef ENABLE_THREADS
+
+BOOST_AUTO_TEST_CASE( test_cache_per_thread )
+{
+   Scoped_cache scoped_cache(true);
+   bool enabled_in_other_thread = true;
+
+   std::thread t([&enabled_in_other_thread] () {
+      enabled_in_other_thread = is_cache_enabled();
+   });
+   t.join();
+
+   BOOST_CHECK(is_cache_enabled());
+   BOOST_CHECK(!enabled_in_other_thread);
+}
+
+BOOST_AUTO_TEST_CASE( test_threads )
+{
+   const double expected = sum_loop_functions(scale2);
+   const std::size_t n_threads = 4;
+
+   for (const bool cache: {false, true}) {
+      std::vector<double> results(n_threads);
+      std::vector<std::thread> threads;
+
+      for (std::size_t i = 0; i < n_threads; i++) {
+         threads.emplace_back([&results, i, cache] () {
+            Scoped_cache scoped_cache(cache);
+            for (int n = 0; n < 10; n++)
+               results[i] = sum_loop_functions(scale2);
+         });
+      }
+
+      for (auto& t: threads)
+         t.join();
+
+      for (const auto r: results)
+         BOOST_CHECK_EQUAL(r, expected);
+   }
+}
+
+#endif
+
 #if defined(ENABLE_LOOPTOOLS) || defined(ENABLE_FFLITE)
 
+BOOST_AUTO_TEST_CASE(test_scale_dependence)
+{
+   // LoopTools and FF are evaluated at Q^2 = 1 and shifted to the
+   // given scale, the SOFTSUSY functions are evaluated at the given
+   // scale directly
+   const double m2a = 2., m2b = 3.;
+
+   for (const double q2: { 1., 1e4 }) {
+      const double q = std::sqrt(q2);
+      BOOST_CHECK_CLOSE_FRACTION(A0 (m2a, q2).real(),
+                                 softsusy::a0(std::sqrt(m2a), q), 1e-10);
+      BOOST_CHECK_CLOSE_FRACTION(B0 (p2, m2a, m2b, q2).real(),
+                                 softsusy::b0(p, std::sqrt(m2a), std::sqrt(m2b), q), 1e-10);
+      BOOST_CHECK_CLOSE_FRACTION(B1 (p2, m2a, m2b, q2).real(),
+                                 -softsusy::b1(p, std::sqrt(m2a), std::sqrt(m2b), q), 1e-10);
+      BOOST_CHECK_CLOSE_FRACTION(B00(p2, m2a, m2b, q2).real(),
+                                 softsusy::b22(p, std::sqrt(m2a), std::sqrt(m2b), q), 1e-8);
+   }
+}
+
+BOOST_AUTO_TEST_CASE(test_real_vs_complex_A0)
+{
+   for (const double m2: { 0., 1e-5, 2., 3e6 }) {
+      for (const double q2: { 1., 1e4 }) {
+         BOOST_CHECK_SMALL(abs(A0(m2, q2) - A0(complex<double>(m2), q2)),
+                           1e-10*std::max(1., m2));
+      }
+   }
+}
+
 const double eps = numeric_limits<double>::min();
 const complex<double> neg_m2 = complex<double>(-0.1, -eps);
 
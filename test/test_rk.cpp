@@ -143,6 +143,36 @@ BOOST_AUTO_TEST_CASE( test_non_perturbative )
                           beta_non_pert_legacy, beta_non_pert_eigen);
 }
 
+BOOST_AUTO_TEST_CASE( test_ode_stepper )
+{
+   Eigen::ArrayXd start(10);
+   for (int i = 0; i < start.size(); i++)
+      start(i) = 0.5 + 0.1 * (i + 1)*(i + 1);
+
+   using Derivs = Eigen::ArrayXd(*)(double, const Eigen::ArrayXd&);
+   const Derivs derivs = beta_ten_dim_eigen;
+   const double from = std::log(100.), to = std::log(1.0e10), tol = 1.0e-7;
+   const double guess = (from - to) * 0.1, hmin = (from - to) * tol * 1.0e-5;
+
+   // temporaries allocated in each step
+   Eigen::ArrayXd p_step(start);
+   runge_kutta::integrateOdes(p_step, from, to, tol, guess, hmin, derivs,
+                              runge_kutta::odeStepper<Eigen::ArrayXd,Derivs>);
+
+   // temporaries allocated once per integration
+   Eigen::ArrayXd p_once(start);
+   runge_kutta::integrateOdes(p_once, from, to, tol, guess, hmin, derivs);
+
+   Eigen::ArrayXd p_integrator(start);
+   runge_kutta::Basic_rk_integrator<Eigen::ArrayXd>()(
+      from, to, p_integrator, derivs, tol);
+
+   for (int i = 0; i < start.size(); i++) {
+      BOOST_CHECK_EQUAL(p_step(i), p_once(i));
+      BOOST_CHECK_EQUAL(p_step(i), p_integrator(i));
+   }
+}
+
 Eigen::ArrayXd beta_gauge_one_loop(double x, const Eigen::ArrayXd& parameters)
 {
    const int num_pars = parameters.size();
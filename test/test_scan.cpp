@@ -2,7 +2,10 @@
 #define BOOST_TEST_MODULE test_scan
 
 #include <boost/test/unit_test.hpp>
+#include "continuation.hpp"
+#include "scan.hpp"
 #include <algorithm>
+#include <cmath>
 #include <random>
 
 /**
@@ -67,3 +70,109 @@ BOOST_AUTO_TEST_CASE( uniform_distribution_start_stop )
    BOOST_CHECK(*std::max_element(std::begin(a), std::end(a)) <= stop);
    BOOST_CHECK(*std::min_element(std::begin(a), std::end(a)) >= start);
 }
+
+namespace {
+
+using Toy_continuation = flexiblesusy::Continuation<double>;
+
+/**
+ * Toy point solver, which finds the cube root of the sum of the
+ * parameters with at most 8 Newton iterations, starting from 1 by
+ * default.  Starting far away from the solution therefore fails.
+ */
+Toy_continuation::Point solve_cube_root(const Eigen::VectorXd& p,
+                                        const Eigen::ArrayXd& guess)
+{
+   const double a = p.sum();
+   double x = guess.size() > 0 ? guess(0) : 1.;
+   Toy_continuation::Point point;
+
+   for (int i = 1; i <= 8; i++) {
+      const double dx = (x*x*x - a)/(3*x*x);
+      x -= dx;
+      if (std::abs(dx) < 1e-12*std::abs(x)) {
+         point.result = x;
+         point.solution = Eigen::ArrayXd::Constant(1, x);
+         point.iterations = i;
+         break;
+      }
+   }
+
+   return point;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE( continuation_1d )
+{
+   using namespace flexiblesusy;
+
+   const auto range = float_range(1., 1000., 20);
+
+   int failures_cold = 0;
+   for (const auto p: range) {
+      if (solve_cube_root(Eigen::VectorXd::Constant(1, p), Eigen::ArrayXd()).solution.size() == 0)
+         failures_cold++;
+   }
+
+   Toy_continuation continuation(solve_cube_root);
+   const auto points = continuation.run(range);
+
+   BOOST_REQUIRE_EQUAL(points.size(), range.size());
+   BOOST_CHECK_GT(failures_cold, 0);
+   BOOST_CHECK_EQUAL(continuation.get_number_of_failures(), 0);
+
+   for (std::size_t i = 0; i < range.size(); i++)
+      BOOST_CHECK_CLOSE_FRACTION(points[i].result, std::cbrt(range[i]), 1e-10);
+
+   BOOST_TEST_MESSAGE("failed points with default initial guess: " << failures_cold);
+   BOOST_TEST_MESSAGE("continuation: " << continuation.get_number_of_solves()
+                      << " solves, " << continuation.get_number_of_iterations()
+                      << " iterations");
+}
+
+BOOST_AUTO_TEST_CASE( continuation_bisection )
+{
+   using namespace flexiblesusy;
+
+   const std::vector<double> range{1., 1000.};
+
+   Toy_continuation continuation(solve_cube_root);
+   continuation.set_max_bisections(8);
+   const auto points = continuation.run(range);
+
+   BOOST_CHECK_EQUAL(continuation.get_number_of_failures(), 0);
+   BOOST_CHECK_GT(continuation.get_number_of_solves(), range.size());
+   BOOST_CHECK_CLOSE_FRACTION(points.back().result, 10., 1e-10);
+
+   // without bisections the point falls back to the default initial guess
+   continuation.set_max_bisections(0);
+   continuation.run(range);
+
+   BOOST_CHECK_EQUAL(continuation.get_number_of_failures(), 1);
+}
+
+BOOST_AUTO_TEST_CASE( continuation_2d )
+{
+   using namespace flexiblesusy;
+
+   const std::vector<double> xs{1., 2., 3.}, ys{10., 20.};
+   const auto grid = serpentine_grid(xs, ys);
+
+   BOOST_REQUIRE_EQUAL(grid.size(), 6);
+   BOOST_CHECK_EQUAL(grid[2](0), 3.);
+   BOOST_CHECK_EQUAL(grid[3](0), 3.);
+   BOOST_CHECK_EQUAL(grid[3](1), 20.);
+   BOOST_CHECK_EQUAL(grid[5](0), 1.);
+
+   for (std::size_t i = 1; i < grid.size(); i++)
+      BOOST_CHECK_CLOSE_FRACTION((grid[i] - grid[i-1]).norm(), i == 3 ? 10. : 1., 1e-15);
+
+   Toy_continuation continuation(solve_cube_root);
+   const auto points = continuation.run(grid);
+
+   BOOST_CHECK_EQUAL(continuation.get_number_of_failures(), 0);
+
+   for (std::size_t i = 0; i < grid.size(); i++)
+      BOOST_CHECK_CLOSE_FRACTION(points[i].result, std::cbrt(grid[i].sum()), 1e-10);
+}
@@ -5,10 +5,19 @@
 #include <boost/test/unit_test.hpp>
 
 #include "slha_io.hpp"
+#include "slha_reader.hpp"
 #include "linalg2.hpp"
 #include "stopwatch.hpp"
 #include <Eigen/Core>
 #include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace flexiblesusy;
 
@@ -322,6 +331,272 @@ BOOST_AUTO_TEST_CASE( test_processor_vs_loop )
    BOOST_CHECK_LT(100. * processor_time, loop_time);
 }
 
+namespace {
+
+const char slha_input[] =
+   "# SLHA input\n"
+   "Block MODSEL          # select model\n"
+   "    6   0             # flavour violation\n"
+   "BLOCK sminputs\n"
+   "    1   1.279340000e+02   # alpha^(-1) SM MSbar(MZ)\n"
+   "    2   1.166370000e-05   # G_Fermi\n"
+   "\t3   1.176000000e-01   # alpha_s(MZ) SM MSbar\n"
+   "Block MINPAR\n"
+   "    1   1.250000000e+02   # m0\n"
+   "    2   5.000000000e+02   # m12\n"
+   "block Yu Q= 9.1e+01\n"
+   "  1  1  1.0\n"
+   "  2  2  2.0\n"
+   "  3  3  3.0   # top\n"
+   "DECAY 6 1.5\n"
+   "  1.0  2  5  24\n"
+   "Block MINPAR\n"
+   "    3   1.000000000e+01   # TanBeta\n";
+
+/**
+ * Reads a SLHA block in the same way as SLHA_io::read_block() did
+ * before the introduction of the SLHA_reader, i.e. by searching the
+ * SLHAea collection and converting each field via
+ * boost::lexical_cast.  Only used as a reference.
+ */
+double read_block_slhaea(const SLHAea::Coll& data, const std::string& block_name,
+                         const SLHA_io::Tuple_processor& processor)
+{
+   auto block = data.find(data.cbegin(), data.cend(), block_name);
+   double scale = 0.;
+
+   while (block != data.cend()) {
+      for (const auto& line: *block) {
+         if (!line.is_data_line()) {
+            if (line.size() > 3 && line[2] == "Q=")
+               scale = SLHAea::to<double>(line[3]);
+            continue;
+         }
+
+         if (line.size() >= 2)
+            processor(SLHAea::to<int>(line[0]), SLHAea::to<double>(line[1]));
+      }
+
+      ++block;
+      block = data.find(block, data.cend(), block_name);
+   }
+
+   return scale;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE( test_reader_vs_slhaea )
+{
+   SLHAea::Coll coll;
+   coll.str(slha_input);
+
+   SLHA_reader reader;
+   reader.read_from_string(slha_input);
+
+   for (const auto& name: {"MODSEL", "SMINPUTS", "sminputs", "MinPar", "MINPAR", "Yu", "NoBlock"}) {
+      std::map<int, double> entries_slhaea, entries_reader;
+
+      const double scale_slhaea = read_block_slhaea(
+         coll, name, [&entries_slhaea] (int k, double v) { entries_slhaea[k] = v; });
+      const double scale_reader = reader.read_block(
+         name, [&entries_reader] (int k, double v) { entries_reader[k] = v; });
+
+      BOOST_CHECK_EQUAL(reader.block_exists(name), coll.find(name) != coll.end());
+      BOOST_CHECK_EQUAL(scale_reader, scale_slhaea);
+      BOOST_CHECK(entries_reader == entries_slhaea);
+   }
+
+   BOOST_CHECK_EQUAL(reader.read_entry("MINPAR", 3), 10.);
+   BOOST_CHECK_EQUAL(reader.read_entry("SMInputs", 3), 0.1176);
+   BOOST_CHECK_EQUAL(reader.read_scale("Yu"), 91.);
+
+   Eigen::Matrix<double,3,3> yu(Eigen::Matrix<double,3,3>::Zero());
+   BOOST_CHECK_EQUAL(reader.read_block("Yu", yu), 91.);
+   BOOST_CHECK_EQUAL(yu(0,0), 1.);
+   BOOST_CHECK_EQUAL(yu(1,1), 2.);
+   BOOST_CHECK_EQUAL(yu(2,2), 3.);
+   BOOST_CHECK_EQUAL(yu(0,1), 0.);
+}
+
+BOOST_AUTO_TEST_CASE( test_reader_conversion_error )
+{
+   SLHA_reader reader;
+   reader.read_from_string("Block A\n  1  1.0x\n  2x  2.0\n");
+
+   BOOST_CHECK_THROW(reader.read_entry("A", 1), ReadError);
+   BOOST_CHECK_THROW(reader.read_block("A", [] (int, double) {}), ReadError);
+
+   reader.read_from_string("Block B\n  99999999999  1.0\nBlock C\n  1  1e999\n");
+
+   BOOST_CHECK_THROW(reader.read_block("B", [] (int, double) {}), ReadError);
+   BOOST_CHECK_THROW(reader.read_entry("C", 1), ReadError);
+}
+
+BOOST_AUTO_TEST_CASE( test_reader_non_finite )
+{
+   SLHA_reader reader;
+   reader.read_from_string(
+      "Block A\n  1  nan\n  2  -INF\n  3  Infinity\n  4  +NaN(1)\n  5  nanx\n");
+
+   BOOST_CHECK(std::isnan(reader.read_entry("A", 1)));
+   BOOST_CHECK_EQUAL(reader.read_entry("A", 2), -std::numeric_limits<double>::infinity());
+   BOOST_CHECK_EQUAL(reader.read_entry("A", 3), std::numeric_limits<double>::infinity());
+   BOOST_CHECK(std::isnan(reader.read_entry("A", 4)));
+   BOOST_CHECK_THROW(reader.read_entry("A", 5), ReadError);
+
+   // same as boost::lexical_cast
+   BOOST_CHECK(std::isnan(boost::lexical_cast<double>("+NaN(1)")));
+   BOOST_CHECK_EQUAL(boost::lexical_cast<double>("-INF"), -std::numeric_limits<double>::infinity());
+}
+
+namespace {
+
+/// numeric punctuation of a locale with decimal comma
+struct Decimal_comma : public std::numpunct<char> {
+   char do_decimal_point() const override { return ','; }
+   char do_thousands_sep() const override { return '.'; }
+   std::string do_grouping() const override { return "\3"; }
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE( test_reader_ignores_global_locale )
+{
+   const std::locale previous = std::locale::global(
+      std::locale(std::locale::classic(), new Decimal_comma));
+
+   SLHA_reader reader;
+   reader.read_from_string("Block A\n  1  1.5e+02\n  1000  2.5\n");
+
+   const double entry_1 = reader.read_entry("A", 1);
+   const double entry_1000 = reader.read_entry("A", 1000);
+
+   std::locale::global(previous);
+
+   BOOST_CHECK_EQUAL(entry_1, 150.);
+   BOOST_CHECK_EQUAL(entry_1000, 2.5);
+}
+
+BOOST_AUTO_TEST_CASE( test_read_after_set_block )
+{
+   std::istringstream stream(slha_input);
+   SLHA_io io;
+   io.read_from_stream(stream);
+
+   BOOST_CHECK_EQUAL(io.read_entry("MINPAR", 1), 125.);
+   BOOST_CHECK_EQUAL(io.get_modsel().quark_flavour_violated, false);
+
+   std::ostringstream block;
+   block << "Block MINPAR\n"
+         << "    1   2.000000000e+02   # m0\n";
+   io.set_block(block);
+
+   BOOST_CHECK_EQUAL(io.read_entry("MINPAR", 1), 200.);
+   BOOST_CHECK_EQUAL(io.read_entry("SMINPUTS", 1), 127.934);
+
+   // the echoed SLHA output contains the modified block
+   std::ostringstream output;
+   io.write_to_stream(output);
+   BOOST_CHECK(output.str().find("2.000000000e+02") != std::string::npos);
+   BOOST_CHECK(output.str().find("DECAY 6") != std::string::npos);
+}
+
+#ifdef ENABLE_THREADS
+
+BOOST_AUTO_TEST_CASE( test_concurrent_lazy_updates )
+{
+   const int number_of_threads = 4;
+   std::istringstream stream(slha_input);
+   SLHA_io io;
+   io.read_from_stream(stream);
+
+   // the first calls of get_data() parse the SLHAea data concurrently
+   std::vector<int> has_minpar(number_of_threads, 0);
+   std::vector<std::thread> threads;
+
+   for (int i = 0; i < number_of_threads; i++) {
+      threads.emplace_back([&io, &has_minpar, i] () {
+         has_minpar[i] = io.get_data().find("MINPAR") != io.get_data().cend();
+      });
+   }
+
+   for (auto& t: threads)
+      t.join();
+
+   std::ostringstream block;
+   block << "Block MINPAR\n"
+         << "    1   2.000000000e+02   # m0\n";
+   io.set_block(block);
+
+   // the first read accesses re-build the reader index concurrently
+   std::vector<double> m0(number_of_threads, 0.);
+   threads.clear();
+
+   for (int i = 0; i < number_of_threads; i++) {
+      threads.emplace_back([&io, &m0, i] () {
+         m0[i] = io.read_entry("MINPAR", 1);
+      });
+   }
+
+   for (auto& t: threads)
+      t.join();
+
+   for (int i = 0; i < number_of_threads; i++) {
+      BOOST_CHECK(has_minpar[i]);
+      BOOST_CHECK_EQUAL(m0[i], 200.);
+   }
+}
+
+#endif
+
+/**
+ * Compares the time to read many blocks from a large SLHA input with
+ * the SLHA_reader and with the former SLHAea based implementation.
+ */
+BOOST_AUTO_TEST_CASE( test_reader_vs_slhaea_speed )
+{
+   const int number_of_blocks = 200, number_of_entries = 100;
+   std::string input;
+
+   for (int b = 0; b < number_of_blocks; b++) {
+      input += "Block Block" + std::to_string(b) + " Q= 1.0e+03\n";
+      for (int i = 0; i < number_of_entries; i++)
+         input += "   " + std::to_string(i) + "   " + std::to_string(b + i)
+            + "   # entry " + std::to_string(i) + "\n";
+   }
+
+   double sum_slhaea = 0., sum_reader = 0.;
+   Stopwatch timer;
+
+   timer.start();
+   {
+      SLHAea::Coll coll;
+      coll.str(input);
+      for (int b = 0; b < number_of_blocks; b++)
+         read_block_slhaea(coll, "Block" + std::to_string(b),
+                           [&sum_slhaea] (int, double v) { sum_slhaea += v; });
+   }
+   timer.stop();
+   const double slhaea_time = timer.get_time_in_seconds();
+
+   timer.start();
+   {
+      SLHA_reader reader;
+      reader.read_from_string(input);
+      for (int b = 0; b < number_of_blocks; b++)
+         reader.read_block("Block" + std::to_string(b),
+                           [&sum_reader] (int, double v) { sum_reader += v; });
+   }
+   timer.stop();
+   const double reader_time = timer.get_time_in_seconds();
+
+   BOOST_CHECK_EQUAL(sum_reader, sum_slhaea);
+
+   BOOST_TEST_MESSAGE("time using SLHAea: " << slhaea_time << " s");
+   BOOST_TEST_MESSAGE("time using SLHA_reader: " << reader_time << " s");
+}
+
 BOOST_AUTO_TEST_CASE( test_slha_mixing_matrix_convention )
 {
    Eigen::Matrix<double, 2, 2> mass_matrix;
@@ -0,0 +1,142 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_task_graph
+
+#include <boost/test/unit_test.hpp>
+
+#include "config.h"
+#include "error.hpp"
+#include "task_graph.hpp"
+
+#ifdef ENABLE_THREADS
+#include "global_thread_pool.hpp"
+#endif
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace flexiblesusy;
+
+BOOST_AUTO_TEST_CASE( test_empty_graph )
+{
+   Task_graph graph;
+   BOOST_CHECK_NO_THROW(graph.run());
+   BOOST_CHECK_EQUAL(graph.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_independent_tasks )
+{
+   const int N = 1000;
+   std::atomic<long> sum{0};
+   Task_graph graph;
+
+   for (int i = 0; i < N; i++) {
+      graph.add([&sum, i] { sum += i; });
+   }
+
+   graph.run();
+   BOOST_CHECK_EQUAL(sum.load(), static_cast<long>(N*(N - 1)/2));
+
+   // graph can be run again
+   graph.run();
+   BOOST_CHECK_EQUAL(sum.load(), static_cast<long>(N*(N - 1)));
+}
+
+BOOST_AUTO_TEST_CASE( test_dependencies )
+{
+   // diamond a -> (b, c) -> d, and chain d -> e
+   std::mutex mutex;
+   std::vector<char> order;
+   const auto record = [&mutex, &order] (char c) {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(c);
+   };
+
+   Task_graph graph;
+   const auto a = graph.add([&] { record('a'); });
+   const auto b = graph.add([&] { record('b'); }, {a});
+   const auto c = graph.add([&] { record('c'); }, {a});
+   const auto d = graph.add([&] { record('d'); }, {b, c});
+   graph.add([&] { record('e'); }, {d});
+
+   graph.run();
+
+   BOOST_REQUIRE_EQUAL(order.size(), 5);
+   BOOST_CHECK_EQUAL(order.front(), 'a');
+   BOOST_CHECK(order[1] == 'b' || order[1] == 'c');
+   BOOST_CHECK(order[2] == 'b' || order[2] == 'c');
+   BOOST_CHECK_EQUAL(order[3], 'd');
+   BOOST_CHECK_EQUAL(order[4], 'e');
+}
+
+BOOST_AUTO_TEST_CASE( test_results )
+{
+   double x = 0., y = 0., z = 0.;
+
+   Task_graph graph;
+   const auto tx = graph.add([&x] { x = 1.; }, {}, "x");
+   const auto ty = graph.add([&y] { y = 2.; }, {}, "y");
+   graph.add([&] { z = x + y; }, {tx, ty}, "z");
+   graph.run();
+
+   BOOST_CHECK_EQUAL(z, 3.);
+}
+
+BOOST_AUTO_TEST_CASE( test_invalid_dependency )
+{
+   Task_graph graph;
+   graph.add([] {});
+
+   BOOST_CHECK_THROW(graph.add([] {}, {1}), SetupError);
+   BOOST_CHECK_EQUAL(graph.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE( test_exception )
+{
+   std::atomic<int> runs{0};
+   bool dependent_run = false;
+
+   Task_graph graph;
+   const auto t = graph.add([] { throw std::runtime_error("task failed"); });
+   graph.add([&dependent_run] { dependent_run = true; }, {t});
+   for (int i = 0; i < 10; i++) {
+      graph.add([&runs] { runs++; });
+   }
+
+   BOOST_CHECK_THROW(graph.run(), std::runtime_error);
+   BOOST_CHECK(!dependent_run);
+   BOOST_CHECK_EQUAL(runs.load(), 10);
+}
+
+#ifdef ENABLE_THREADS
+
+BOOST_AUTO_TEST_CASE( test_nested_graphs )
+{
+   // more graphs than threads run in tasks of the thread pool, which
+   // must not dead-lock, because each run() executes tasks itself
+   const std::size_t N_outer = 4 * (global_thread_pool().size() + 1);
+   const int N_inner = 50;
+   std::atomic<long> sum{0};
+   std::vector<std::future<void>> results;
+
+   for (std::size_t i = 0; i < N_outer; i++) {
+      results.push_back(global_thread_pool().run_packaged_task([&sum, N_inner] {
+         Task_graph graph;
+         const auto first = graph.add([&sum] { sum++; });
+         for (int k = 1; k < N_inner; k++) {
+            graph.add([&sum] { sum++; }, {first});
+         }
+         graph.run();
+      }));
+   }
+
+   for (auto& r: results) {
+      r.get();
+   }
+
+   BOOST_CHECK_EQUAL(sum.load(), static_cast<long>(N_outer * N_inner));
+}
+
+#endif
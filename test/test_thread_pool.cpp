@@ -4,9 +4,13 @@
 #include <boost/test/unit_test.hpp>
 
 #include "thread_pool.hpp"
+#include "pv.hpp"
 #include "stopwatch.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <future>
 #include <thread>
 
 using namespace flexiblesusy;
@@ -90,6 +94,98 @@ BOOST_AUTO_TEST_CASE(test_fill_array_packaged_task)
       BOOST_CHECK_EQUAL(a[i], i);
 }
 
+/// sums 0 + 1 + ... + n recursively, each summand being a sub-task
+long sum_nested(Thread_pool& tp, long n)
+{
+   if (n <= 0)
+      return 0;
+
+   auto fut = tp.run_packaged_task([&tp, n](){ return sum_nested(tp, n - 1); });
+
+   return n + tp.wait(fut);
+}
+
+BOOST_AUTO_TEST_CASE(test_nested_wait)
+{
+   for (std::size_t pool_size = 0; pool_size < 4; pool_size++) {
+      Thread_pool tp(pool_size);
+      std::array<std::future<long>, 20> f{};
+
+      // occupy all threads with tasks, which wait for sub-tasks
+      for (std::size_t i = 0; i < f.size(); i++)
+         f[i] = tp.run_packaged_task([&tp](){ return sum_nested(tp, 50); });
+
+      for (std::size_t i = 0; i < f.size(); i++)
+         BOOST_CHECK_EQUAL(tp.wait(f[i]), 50*51/2);
+   }
+}
+
+BOOST_AUTO_TEST_CASE(test_wait_void)
+{
+   int result = 0;
+
+   Thread_pool tp(2);
+   auto fut = tp.run_packaged_task([&result](){ result = 1; });
+   tp.wait(fut);
+
+   BOOST_CHECK_EQUAL(result, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_wait_runs_only_sub_tasks)
+{
+   Thread_pool tp(1);
+   std::promise<void> sub_task_submitted, sibling_submitted;
+   std::atomic<bool> waiting{false};
+   bool sibling_run_while_waiting = true;
+
+   auto task = tp.run_packaged_task([&] {
+      auto sub_task = tp.run_packaged_task([] { return 1; });
+      sub_task_submitted.set_value();
+      sibling_submitted.get_future().wait();
+      waiting = true;
+      const int result = tp.wait(sub_task);
+      waiting = false;
+      return result;
+   });
+
+   sub_task_submitted.get_future().wait();
+   auto sibling = tp.run_packaged_task([&] {
+      sibling_run_while_waiting = waiting.load(); });
+   sibling_submitted.set_value();
+
+   // the task must not run the sibling while waiting for its sub-task
+   BOOST_CHECK_EQUAL(task.get(), 1);
+   tp.wait(sibling);
+   BOOST_CHECK(!sibling_run_while_waiting);
+}
+
+BOOST_AUTO_TEST_CASE(test_loop_function_cache_setting)
+{
+   Thread_pool tp(2);
+
+   for (const bool cache: {true, false}) {
+      passarino_veltman::Scoped_cache scoped_cache(cache);
+      auto fut = tp.run_packaged_task([](){
+         return passarino_veltman::is_cache_enabled(); });
+      BOOST_CHECK_EQUAL(tp.wait(fut), cache);
+   }
+}
+
+BOOST_AUTO_TEST_CASE(test_task_context)
+{
+   const std::size_t slot = Task_context::reserve_slot();
+   int value = 0;
+
+   Thread_pool tp(2);
+
+   for (void* ptr: {static_cast<void*>(&value), static_cast<void*>(nullptr)}) {
+      Task_context::current().set(slot, ptr);
+      auto fut = tp.run_packaged_task([slot](){
+         return Task_context::current().get(slot); });
+      BOOST_CHECK_EQUAL(tp.wait(fut), ptr);
+   }
+}
+
 template <typename Array>
 void fill_sequential(Array& a)
 {
@@ -0,0 +1,202 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE test_thread_pool_benchmark
+
+#include <boost/test/unit_test.hpp>
+
+#include "thread_pool.hpp"
+#include "stopwatch.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using namespace flexiblesusy;
+
+namespace {
+
+/**
+ * Thread pool with a single mutex-protected task queue, as used by
+ * FlexibleSUSY before the introduction of the work-stealing
+ * Thread_pool.  Only used as a reference in this benchmark.
+ */
+class Single_queue_thread_pool {
+public:
+   explicit Single_queue_thread_pool(std::size_t pool_size)
+   {
+      for (std::size_t i = 0; i < pool_size; ++i)
+         threads.emplace_back(
+            [this] () {
+               for (;;) {
+                  std::function<void()> task;
+
+                  {
+                     std::unique_lock<std::mutex> lock(mutex);
+                     condition.wait(lock, [this]{ return stop || !tasks.empty(); });
+                     if (stop && tasks.empty())
+                        return;
+                     task = std::move(tasks.front());
+                     tasks.pop();
+                  }
+
+                  task();
+               }
+            });
+   }
+
+   ~Single_queue_thread_pool()
+   {
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         stop = true;
+      }
+      condition.notify_all();
+      for (auto& t: threads)
+         t.join();
+   }
+
+   template <typename Task>
+   auto run_packaged_task(Task&& task) -> std::future<decltype(task())>
+   {
+      using return_t = decltype(task());
+      auto ptask = std::make_shared<std::packaged_task<return_t()>>([task](){ return task(); });
+      std::future<return_t> fut = ptask->get_future();
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         tasks.emplace([ptask](){ (*ptask)(); });
+      }
+      condition.notify_one();
+      return fut;
+   }
+
+   template <typename Task>
+   void run_task(Task&& task)
+   {
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         tasks.emplace(std::forward<Task>(task));
+      }
+      condition.notify_one();
+   }
+
+private:
+   std::vector<std::thread> threads{};
+   std::queue<std::function<void()>> tasks{};
+   std::mutex mutex{};
+   std::condition_variable condition{};
+   bool stop{false};
+};
+
+template <typename F>
+double measure_time(F&& f)
+{
+   Stopwatch s;
+   s.start();
+   f();
+   s.stop();
+
+   return s.get_time_in_seconds();
+}
+
+/// submits many tiny tasks, the pool is destroyed at the end
+template <typename Pool>
+double time_run_task(std::size_t n_tasks, std::atomic<long>& sum)
+{
+   return measure_time([n_tasks, &sum] () {
+      Pool tp(std::thread::hardware_concurrency());
+      for (std::size_t i = 0; i < n_tasks; i++)
+         tp.run_task([&sum, i](){ sum += i; });
+   });
+}
+
+/// submits batches of packaged tasks and waits for the futures,
+/// similar to the beta function calculation
+template <typename Pool>
+double time_run_packaged_task(std::size_t n_batches, std::size_t batch_size, double& sum)
+{
+   Pool tp(std::thread::hardware_concurrency());
+   std::vector<std::future<double>> futures(batch_size);
+
+   return measure_time([&] () {
+      for (std::size_t b = 0; b < n_batches; b++) {
+         for (std::size_t i = 0; i < batch_size; i++)
+            futures[i] = tp.run_packaged_task([i](){ return 1.*i; });
+         for (std::size_t i = 0; i < batch_size; i++)
+            sum += futures[i].get();
+      }
+   });
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(test_run_task_benchmark)
+{
+   const std::size_t N = 200000;
+   std::atomic<long> sum_ws{0}, sum_sq{0};
+
+   const double time_ws = time_run_task<Thread_pool>(N, sum_ws);
+   const double time_sq = time_run_task<Single_queue_thread_pool>(N, sum_sq);
+
+   BOOST_CHECK_EQUAL(sum_ws.load(), sum_sq.load());
+   BOOST_CHECK_EQUAL(sum_ws.load(), static_cast<long>(N*(N - 1)/2));
+
+   BOOST_TEST_MESSAGE("run_task, " << N << " tasks:");
+   BOOST_TEST_MESSAGE("   work-stealing pool: " << time_ws << "s");
+   BOOST_TEST_MESSAGE("   single-queue pool : " << time_sq << "s");
+}
+
+BOOST_AUTO_TEST_CASE(test_run_packaged_task_benchmark)
+{
+   const std::size_t N_batches = 10000, N_batch_size = 20;
+   double sum_ws = 0., sum_sq = 0.;
+
+   const double time_ws = time_run_packaged_task<Thread_pool>(N_batches, N_batch_size, sum_ws);
+   const double time_sq = time_run_packaged_task<Single_queue_thread_pool>(N_batches, N_batch_size, sum_sq);
+
+   BOOST_CHECK_EQUAL(sum_ws, sum_sq);
+
+   BOOST_TEST_MESSAGE("run_packaged_task, " << N_batches << " batches of "
+                      << N_batch_size << " tasks:");
+   BOOST_TEST_MESSAGE("   work-stealing pool: " << time_ws << "s");
+   BOOST_TEST_MESSAGE("   single-queue pool : " << time_sq << "s");
+}
+
+BOOST_AUTO_TEST_CASE(test_nested_tasks)
+{
+   const std::size_t N_outer = 100, N_inner = 100;
+   std::atomic<long> sum{0};
+
+   const double time = measure_time([&] () {
+      Thread_pool tp(std::thread::hardware_concurrency());
+      for (std::size_t i = 0; i < N_outer; i++)
+         tp.run_task([&tp, &sum, N_inner] () {
+            for (std::size_t k = 0; k < N_inner; k++)
+               tp.run_task([&sum](){ sum += 1; });
+         });
+   });
+
+   BOOST_CHECK_EQUAL(sum.load(), static_cast<long>(N_outer*N_inner));
+
+   BOOST_TEST_MESSAGE("nested run_task, " << N_outer*N_inner << " tasks: " << time << "s");
+}
+
+BOOST_AUTO_TEST_CASE(test_large_task)
+{
+   // task which does not fit into the small buffer
+   std::array<double, 100> a{};
+   a.fill(1.);
+   double result = 0.;
+
+   {
+      Thread_pool tp(2);
+      tp.run_task([a, &result](){ for (const auto x: a) result += x; });
+   }
+
+   BOOST_CHECK_EQUAL(result, 100.);
+}
@@ -94,6 +94,7 @@ _run_spectrum_generator()
 --slha-output-file=
 --spectrum-output-file=
 --database-output-file=
+--columnar-output-file=
 --rgflow-output-file=
 --build-info
 --model-info
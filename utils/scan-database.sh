@@ -18,9 +18,15 @@
 #    --scan-range=MINPAR[1]=100~300:10 \
 #    --database-output-file=scan.db
 #
+# With --compare-insert the rows of the database are afterwards
+# written once more into temporary databases, once row by row (one
+# transaction per row) and once in a single transaction, and the
+# times of both are printed.
+#
 # Author: Alexander Voigt
 
 database_output_file=
+compare_insert=no
 scan_range=
 slha_input=
 slha_input_file=
@@ -45,12 +51,49 @@ do_actions_at_exit() {
     eval "$actions_at_exit"
 }
 
+#_____________________________________________________________________
+# prints the time in seconds needed to execute the SQL statements
+# given on stdin on an empty temporary database
+time_sql() {
+    local sql_db start stop
+    sql_db=$(mktemp)
+    start=$(date +%s.%N)
+    sqlite3 "$sql_db"
+    stop=$(date +%s.%N)
+    rm -f "$sql_db"
+    echo "$stop - $start" | bc -l
+}
+
+#_____________________________________________________________________
+# writes the rows of the given database into temporary databases,
+# once row by row and once in a single transaction, and prints the
+# time of both
+compare_insert() {
+    local db="$1" dump time_per_row time_batch
+
+    if ! command -v sqlite3 > /dev/null 2>&1; then
+        echo "Warning: sqlite3 not found, skipping insert comparison"
+        return
+    fi
+
+    dump=$(sqlite3 "$db" .dump | grep -v -e '^BEGIN TRANSACTION;$' -e '^COMMIT;$')
+
+    time_per_row=$({ echo "PRAGMA synchronous = OFF;" ; echo "$dump" ; } | time_sql)
+    time_batch=$({ echo "PRAGMA synchronous = OFF;" ; echo "BEGIN TRANSACTION;" ; \
+                   echo "$dump" ; echo "COMMIT;" ; } | time_sql)
+
+    printf "re-inserting the rows of %s row by row: %.4f s\n" "$db" "$time_per_row"
+    printf "re-inserting the rows of %s in one transaction: %.4f s\n" "$db" "$time_batch"
+}
+
 #_____________________________________________________________________
 help() {
 cat <<EOF
 Usage: ./`basename $0` [options]
 Options:
 
+  --compare-insert      Compare the time to insert the rows of the
+                        database row by row and in one transaction
   --database-output-file=<filename> Name of database output file
   --scan-range=         Scan range
                         Syntax: <block>[<entry>]=<start>~<stop>:<steps-1>
@@ -89,6 +132,7 @@ if test $# -gt 0 ; then
         esac
 
         case $1 in
+            --compare-insert)        compare_insert=yes ;;
             --database-output-file=*) database_output_file=$optarg ;;
             --scan-range=*)          scan_range=$optarg ;;
             --slha-input-file=*)     slha_input_file=$optarg ;;
@@ -128,6 +172,8 @@ steps=$(echo "$scan_range" | awk -F : '{ print $NF }'      | sed -e 's/[eE]+*/*1
 block=$(echo "$scan_range" | awk -F [ '{ print $1 }')
 entry=$(echo "$scan_range" | awk -F '[][]' '{ print $2 }')
 
+start_time=$(date +%s.%N)
+
 # start scan over points
 for i in `seq 0 $steps`; do
     # calculate current value for the scanned variable
@@ -162,3 +208,16 @@ EOF
 
     echo "running ${spectrum_generator} with ${block}[${entry}] = ${value}"
 done
+
+stop_time=$(date +%s.%N)
+
+# print throughput
+cat <<EOF | bc -l | xargs printf "wrote %d points to ${database_output_file} in %.2f s (%.2f points/s)\n"
+$steps + 1
+$stop_time - $start_time
+($steps + 1) / ($stop_time - $start_time)
+EOF
+
+if test "x$compare_insert" = "xyes"; then
+    compare_insert "$database_output_file"
+fi